@@ -0,0 +1,388 @@
+/*
+Benchmark
+
+This sketch times the Arduboy2 library's drawing and display functions,
+reporting the number of CPU cycles each call takes. The results are shown
+on the screen and sent to the USB serial port, so they can be compared
+between library versions, between the Sprites and SpritesB classes,
+or between different boards.
+*/
+
+/*
+Written in 2026 for the Arduboy2 library.
+
+To the extent possible under law, the author(s) have dedicated all copyright
+and related and neighboring rights to this software to the public domain
+worldwide. This software is distributed without any warranty.
+
+You should have received a copy of the CC0 Public Domain Dedication along with
+this software. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+*/
+
+#include <Arduboy2.h>
+
+Arduboy2 arduboy;
+
+// The number of times each test is repeated. The average is reported.
+#define REPEAT 32
+
+// The number of result lines that fit on the screen
+#define LINES_PER_PAGE 8
+
+// The frame rate determines the scrolling speed when a button is held
+#define FRAME_RATE 10
+
+// ---------------------------------------------------------------------------
+// Images
+// ---------------------------------------------------------------------------
+
+// A 16x16 ball, for the Sprites drawOverwrite(), drawSelfMasked() and
+// drawErase() draw modes
+const uint8_t PROGMEM ball[] = {
+  16, 16,
+  0xE0, 0x18, 0x04, 0x02, 0x32, 0x79, 0x79, 0x31,
+  0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x18, 0xE0,
+  0x07, 0x18, 0x20, 0x40, 0x40, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x18, 0x07
+};
+
+// The mask for the ball, for drawExternalMask()
+const uint8_t PROGMEM ballMask[] = {
+  16, 16,
+  0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0,
+  0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x07
+};
+
+// The ball with its mask interleaved, for drawPlusMask()
+const uint8_t PROGMEM ballPlusMask[] = {
+  16, 16,
+  0xE0, 0xE0, 0x18, 0xF8, 0x04, 0xFC, 0x02, 0xFE,
+  0x32, 0xFE, 0x79, 0xFF, 0x79, 0xFF, 0x31, 0xFF,
+  0x01, 0xFF, 0x01, 0xFF, 0x01, 0xFF, 0x02, 0xFE,
+  0x02, 0xFE, 0x04, 0xFC, 0x18, 0xF8, 0xE0, 0xE0,
+  0x07, 0x07, 0x18, 0x1F, 0x20, 0x3F, 0x40, 0x7F,
+  0x40, 0x7F, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF,
+  0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x40, 0x7F,
+  0x40, 0x7F, 0x20, 0x3F, 0x18, 0x1F, 0x07, 0x07
+};
+
+// ---------------------------------------------------------------------------
+// Tests
+// ---------------------------------------------------------------------------
+
+// Each test makes one call to the function being timed. The positions are:
+//   alg:  aligned. Y is a multiple of 8, so no bit shifting is needed.
+//   unal: unaligned. Y is not a multiple of 8.
+//   clip: partly off the top left corner of the screen.
+
+void testEmpty() { }
+
+void testPixel() { arduboy.drawPixel(61, 29); }
+void testFillRectAlg() { arduboy.fillRect(32, 16, 32, 16); }
+void testFillRectUnal() { arduboy.fillRect(32, 19, 32, 16); }
+void testFillRectClip() { arduboy.fillRect(-16, -8, 32, 16); }
+void testFillScreen() { arduboy.fillScreen(WHITE); }
+void testHLine() { arduboy.drawFastHLine(32, 29, 64); }
+void testVLine() { arduboy.drawFastVLine(61, 16, 32); }
+void testLineDiag() { arduboy.drawLine(10, 3, 117, 60); }
+void testLineClip() { arduboy.drawLine(-40, -20, 60, 40); }
+void testCircle() { arduboy.drawCircle(64, 32, 12); }
+void testFillCircle() { arduboy.fillCircle(64, 32, 12); }
+void testRoundRect() { arduboy.drawRoundRect(32, 16, 64, 32, 6); }
+void testFillRoundRect() { arduboy.fillRoundRect(32, 16, 64, 32, 6); }
+
+void testBitmapAlg() {
+  arduboy.drawBitmap(20, 24, Arduboy2Base::arduboy_logo, 88, 16);
+}
+void testBitmapUnal() {
+  arduboy.drawBitmap(20, 27, Arduboy2Base::arduboy_logo, 88, 16);
+}
+void testBitmapClip() {
+  arduboy.drawBitmap(-44, -8, Arduboy2Base::arduboy_logo, 88, 16);
+}
+void testCompressed() {
+  arduboy.drawCompressed(20, 24, Arduboy2Base::arduboy_logo_compressed);
+}
+
+// The same set of Sprites tests, for either the Sprites or SpritesB class
+template <class S>
+struct SpriteTests {
+  static void overAlg() { S::drawOverwrite(32, 16, ball, 0); }
+  static void overUnal() { S::drawOverwrite(32, 19, ball, 0); }
+  static void overClip() { S::drawOverwrite(-5, -3, ball, 0); }
+  static void xmaskAlg() { S::drawExternalMask(32, 16, ball, ballMask, 0, 0); }
+  static void xmaskUnal() { S::drawExternalMask(32, 19, ball, ballMask, 0, 0); }
+  static void xmaskClip() { S::drawExternalMask(-5, -3, ball, ballMask, 0, 0); }
+  static void plusAlg() { S::drawPlusMask(32, 16, ballPlusMask, 0); }
+  static void plusUnal() { S::drawPlusMask(32, 19, ballPlusMask, 0); }
+  static void plusClip() { S::drawPlusMask(-5, -3, ballPlusMask, 0); }
+  static void selfAlg() { S::drawSelfMasked(32, 16, ball, 0); }
+  static void selfUnal() { S::drawSelfMasked(32, 19, ball, 0); }
+  static void selfClip() { S::drawSelfMasked(-5, -3, ball, 0); }
+  static void eraseAlg() { S::drawErase(32, 16, ball, 0); }
+  static void eraseUnal() { S::drawErase(32, 19, ball, 0); }
+  static void eraseClip() { S::drawErase(-5, -3, ball, 0); }
+};
+
+typedef SpriteTests<Sprites> SpTest;
+typedef SpriteTests<SpritesB> SpBTest;
+
+void testPrint() {
+  arduboy.setCursor(4, 24);
+  arduboy.print(F("Benchmark!"));
+}
+void testDigits() { arduboy.drawDigits(4, 24, 12345, 5); }
+
+void testDisplay() { arduboy.display(); }
+void testDisplayClear() { arduboy.display(CLEAR_BUFFER); }
+void testPaintScreen() { arduboy.paintScreen(arduboy.sBuffer); }
+
+struct Test {
+  const char *name;
+  void (*function)();
+};
+
+// Test names are up to 14 characters, to fit on the screen with the result
+const char nPixel[] PROGMEM = "drawPixel";
+const char nFillRectAlg[] PROGMEM = "fillRect alg";
+const char nFillRectUnal[] PROGMEM = "fillRect unal";
+const char nFillRectClip[] PROGMEM = "fillRect clip";
+const char nFillScreen[] PROGMEM = "fillScreen";
+const char nHLine[] PROGMEM = "hLine 64";
+const char nVLine[] PROGMEM = "vLine 32";
+const char nLineDiag[] PROGMEM = "drawLine";
+const char nLineClip[] PROGMEM = "drawLine clip";
+const char nCircle[] PROGMEM = "drawCircle";
+const char nFillCircle[] PROGMEM = "fillCircle";
+const char nRoundRect[] PROGMEM = "drawRoundRect";
+const char nFillRoundRect[] PROGMEM = "fillRoundRect";
+const char nBitmapAlg[] PROGMEM = "bitmap alg";
+const char nBitmapUnal[] PROGMEM = "bitmap unal";
+const char nBitmapClip[] PROGMEM = "bitmap clip";
+const char nCompressed[] PROGMEM = "compressed";
+
+const char nSpOverAlg[] PROGMEM = "S over alg";
+const char nSpOverUnal[] PROGMEM = "S over unal";
+const char nSpOverClip[] PROGMEM = "S over clip";
+const char nSpXmaskAlg[] PROGMEM = "S xmask alg";
+const char nSpXmaskUnal[] PROGMEM = "S xmask unal";
+const char nSpXmaskClip[] PROGMEM = "S xmask clip";
+const char nSpPlusAlg[] PROGMEM = "S plus alg";
+const char nSpPlusUnal[] PROGMEM = "S plus unal";
+const char nSpPlusClip[] PROGMEM = "S plus clip";
+const char nSpSelfAlg[] PROGMEM = "S self alg";
+const char nSpSelfUnal[] PROGMEM = "S self unal";
+const char nSpSelfClip[] PROGMEM = "S self clip";
+const char nSpEraseAlg[] PROGMEM = "S erase alg";
+const char nSpEraseUnal[] PROGMEM = "S erase unal";
+const char nSpEraseClip[] PROGMEM = "S erase clip";
+
+const char nSpBOverAlg[] PROGMEM = "SB over alg";
+const char nSpBOverUnal[] PROGMEM = "SB over unal";
+const char nSpBOverClip[] PROGMEM = "SB over clip";
+const char nSpBXmaskAlg[] PROGMEM = "SB xmask alg";
+const char nSpBXmaskUnal[] PROGMEM = "SB xmask unal";
+const char nSpBXmaskClip[] PROGMEM = "SB xmask clip";
+const char nSpBPlusAlg[] PROGMEM = "SB plus alg";
+const char nSpBPlusUnal[] PROGMEM = "SB plus unal";
+const char nSpBPlusClip[] PROGMEM = "SB plus clip";
+const char nSpBSelfAlg[] PROGMEM = "SB self alg";
+const char nSpBSelfUnal[] PROGMEM = "SB self unal";
+const char nSpBSelfClip[] PROGMEM = "SB self clip";
+const char nSpBEraseAlg[] PROGMEM = "SB erase alg";
+const char nSpBEraseUnal[] PROGMEM = "SB erase unal";
+const char nSpBEraseClip[] PROGMEM = "SB erase clip";
+
+const char nPrint[] PROGMEM = "print 10 chars";
+const char nDigits[] PROGMEM = "drawDigits 5";
+const char nDisplay[] PROGMEM = "display";
+const char nDisplayClear[] PROGMEM = "display clear";
+const char nPaintScreen[] PROGMEM = "paintScreen";
+
+const Test tests[] PROGMEM = {
+  { nPixel, testPixel },
+  { nFillRectAlg, testFillRectAlg },
+  { nFillRectUnal, testFillRectUnal },
+  { nFillRectClip, testFillRectClip },
+  { nFillScreen, testFillScreen },
+  { nHLine, testHLine },
+  { nVLine, testVLine },
+  { nLineDiag, testLineDiag },
+  { nLineClip, testLineClip },
+  { nCircle, testCircle },
+  { nFillCircle, testFillCircle },
+  { nRoundRect, testRoundRect },
+  { nFillRoundRect, testFillRoundRect },
+  { nBitmapAlg, testBitmapAlg },
+  { nBitmapUnal, testBitmapUnal },
+  { nBitmapClip, testBitmapClip },
+  { nCompressed, testCompressed },
+
+  { nSpOverAlg, SpTest::overAlg },
+  { nSpOverUnal, SpTest::overUnal },
+  { nSpOverClip, SpTest::overClip },
+  { nSpXmaskAlg, SpTest::xmaskAlg },
+  { nSpXmaskUnal, SpTest::xmaskUnal },
+  { nSpXmaskClip, SpTest::xmaskClip },
+  { nSpPlusAlg, SpTest::plusAlg },
+  { nSpPlusUnal, SpTest::plusUnal },
+  { nSpPlusClip, SpTest::plusClip },
+  { nSpSelfAlg, SpTest::selfAlg },
+  { nSpSelfUnal, SpTest::selfUnal },
+  { nSpSelfClip, SpTest::selfClip },
+  { nSpEraseAlg, SpTest::eraseAlg },
+  { nSpEraseUnal, SpTest::eraseUnal },
+  { nSpEraseClip, SpTest::eraseClip },
+
+  { nSpBOverAlg, SpBTest::overAlg },
+  { nSpBOverUnal, SpBTest::overUnal },
+  { nSpBOverClip, SpBTest::overClip },
+  { nSpBXmaskAlg, SpBTest::xmaskAlg },
+  { nSpBXmaskUnal, SpBTest::xmaskUnal },
+  { nSpBXmaskClip, SpBTest::xmaskClip },
+  { nSpBPlusAlg, SpBTest::plusAlg },
+  { nSpBPlusUnal, SpBTest::plusUnal },
+  { nSpBPlusClip, SpBTest::plusClip },
+  { nSpBSelfAlg, SpBTest::selfAlg },
+  { nSpBSelfUnal, SpBTest::selfUnal },
+  { nSpBSelfClip, SpBTest::selfClip },
+  { nSpBEraseAlg, SpBTest::eraseAlg },
+  { nSpBEraseUnal, SpBTest::eraseUnal },
+  { nSpBEraseClip, SpBTest::eraseClip },
+
+  { nPrint, testPrint },
+  { nDigits, testDigits },
+  { nDisplay, testDisplay },
+  { nDisplayClear, testDisplayClear },
+  { nPaintScreen, testPaintScreen }
+};
+
+#define NUM_TESTS (sizeof(tests) / sizeof(tests[0]))
+
+// The result of each test, in CPU cycles per call
+uint32_t results[NUM_TESTS];
+
+// The first result line shown on the screen
+uint8_t topLine = 0;
+
+// ---------------------------------------------------------------------------
+
+// Time REPEAT calls of a function, in microseconds
+uint32_t timeCalls(void (*function)()) {
+  arduboy.clear();
+
+  uint32_t start = micros();
+  for (uint8_t i = 0; i < REPEAT; i++) {
+    function();
+  }
+  return micros() - start;
+}
+
+// Run all the tests, showing progress on the screen
+void runTests() {
+  // the time taken by the loop and function call alone is subtracted
+  uint32_t overhead = timeCalls(testEmpty);
+
+  for (uint8_t i = 0; i < NUM_TESTS; i++) {
+    arduboy.clear();
+    arduboy.setCursor(0, 0);
+    arduboy.print(F("Running test "));
+    arduboy.print(i + 1);
+    arduboy.print(F(" of "));
+    arduboy.print(NUM_TESTS);
+    arduboy.display();
+
+    void (*function)() = (void (*)()) pgm_read_ptr(&tests[i].function);
+    uint32_t elapsed = timeCalls(function);
+
+    elapsed = (elapsed > overhead) ? elapsed - overhead : 0;
+    results[i] = (elapsed * (F_CPU / 1000000UL) + (REPEAT / 2)) / REPEAT;
+  }
+}
+
+// Send the results to the serial port, one test per line
+//
+// The format is kept the same so that results can be compared:
+//   # comment lines, starting with '#'
+//   test name,cycles per call
+void sendResults() {
+  Serial.print(F("# Arduboy2 benchmark, library version "));
+  Serial.println(ARDUBOY_LIB_VER);
+  Serial.print(F("# "));
+  Serial.print(REPEAT);
+  Serial.println(F(" calls per test"));
+  Serial.println(F("# test,cycles"));
+
+  for (uint8_t i = 0; i < NUM_TESTS; i++) {
+    Serial.print((const __FlashStringHelper*) pgm_read_ptr(&tests[i].name));
+    Serial.print(',');
+    Serial.println(results[i]);
+  }
+  Serial.println(F("# end"));
+}
+
+// Show a page of results, starting at topLine
+void showResults() {
+  arduboy.clear();
+
+  for (uint8_t line = 0; line < LINES_PER_PAGE; line++) {
+    uint8_t i = topLine + line;
+
+    if (i >= NUM_TESTS) {
+      break;
+    }
+    arduboy.setCursor(0, line * 8);
+    arduboy.print((const __FlashStringHelper*) pgm_read_ptr(&tests[i].name));
+
+    // right justify the number of cycles
+    uint32_t value = results[i];
+    uint8_t digits = 1;
+    while (value >= 10) {
+      value /= 10;
+      digits++;
+    }
+    arduboy.setCursor(WIDTH + 1 - (digits * 6), line * 8);
+    arduboy.print(results[i]);
+  }
+  arduboy.display();
+}
+
+void setup() {
+  arduboy.begin();
+  arduboy.setFrameRate(FRAME_RATE);
+  Serial.begin(9600);
+
+  runTests();
+  sendResults();
+  showResults();
+}
+
+// UP and DOWN scroll the results. A sends them to the serial port again.
+// B runs the tests again.
+void loop() {
+  if (!arduboy.nextFrame()) {
+    return;
+  }
+  arduboy.pollButtons();
+
+  if (arduboy.pressed(UP_BUTTON) && topLine > 0) {
+    topLine--;
+    showResults();
+  }
+  else if (arduboy.pressed(DOWN_BUTTON) &&
+           topLine < NUM_TESTS - LINES_PER_PAGE) {
+    topLine++;
+    showResults();
+  }
+
+  if (arduboy.justPressed(A_BUTTON)) {
+    sendResults();
+  }
+  else if (arduboy.justPressed(B_BUTTON)) {
+    runTests();
+    sendResults();
+    showResults();
+  }
+}
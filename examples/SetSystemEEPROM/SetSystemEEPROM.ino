@@ -24,6 +24,9 @@ This sketch allows manipulation of the following values in system EEPROM:
 - The "Show Boot Logo" flag. This flag indicates whether or not to display
   the boot logo sequence during start up.
 
+- The "Quick Boot Logo" flag. This flag indicates whether or not to use a
+  shortened boot logo sequence, which any button will abort.
+
 This sketch also allows:
 
 - The entire System EEPROM area to be reset back to default values.
@@ -33,7 +36,7 @@ This sketch also allows:
 ------------------------------------------------------------------------------
 */
 
-// Version 2.2
+// Version 2.3
 
 /*
 ------------------------------------------------------------------------------
@@ -97,6 +100,7 @@ const char StrBtnNo[] PROGMEM = "B:no";
 const char StrShowLogoQ[] PROGMEM = "show boot logo?";
 const char StrShowLEDsQ[] PROGMEM = "show boot LEDs?";
 const char StrShowNameQ[] PROGMEM = "show unit name?";
+const char StrQuickLogoQ[] PROGMEM = "quick boot logo?";
 const char StrBtnTestLogo[] PROGMEM = "UP+DOWN:test logo";
 const char StrNoLogo1[] PROGMEM = "\"SHOW BOOT LOGO\"";
 const char StrNoLogo2[] PROGMEM = "flag is OFF";
@@ -204,9 +208,10 @@ const char StrDecimal[] PROGMEM = "decimal";
 #define FLAGS_BTN_SAVE_X rightStr_P(StrBtnSave)
 #define FLAGS_BTN_SAVE_Y FLAGS_BTN_MENU_Y
 
-#define FLAGS_LOGO_Y 14
-#define FLAGS_LEDS_Y 27
-#define FLAGS_NAME_Y 40
+#define FLAGS_LOGO_Y 11
+#define FLAGS_LEDS_Y 22
+#define FLAGS_NAME_Y 33
+#define FLAGS_QUICK_Y 44
 
 #define FLAGS_Q_X  (charWidth * 2)
 #define FLAGS_SET_X rightStr_P(StrYes)
@@ -315,12 +320,14 @@ uint8_t idIndex;
 bool showLogoFlag;
 bool showLEDsFlag;
 bool showNameFlag;
+bool quickLogoFlag;
 
 // Selected flag
 enum class SelectedFlag : uint8_t {
   selFlagLogo,
   selFlagLEDs,
-  selFlagName
+  selFlagName,
+  selFlagQuick
 };
 
 SelectedFlag currentFlag;
@@ -498,6 +505,7 @@ void stateFlags() {
   if (arduboy.pressed(UP_BUTTON + DOWN_BUTTON)) {
     showNameFlag = arduboy.readShowUnitNameFlag();
     showLEDsFlag = arduboy.readShowBootLogoLEDsFlag();
+    quickLogoFlag = arduboy.readQuickBootLogoFlag();
     if ((showLogoFlag = arduboy.readShowBootLogoFlag()) == true) {
       arduboy.bootLogo();
     }
@@ -644,6 +652,7 @@ void screenFlags() {
   printStr_P(FLAGS_Q_X, FLAGS_LOGO_Y, StrShowLogoQ);
   printStr_P(FLAGS_Q_X, FLAGS_LEDS_Y, StrShowLEDsQ);
   printStr_P(FLAGS_Q_X, FLAGS_NAME_Y, StrShowNameQ);
+  printStr_P(FLAGS_Q_X, FLAGS_QUICK_Y, StrQuickLogoQ);
   printFlagSettings();
   printStr_P(FLAGS_TEST_X, FLAGS_TEST_Y, StrBtnTestLogo);
 }
@@ -706,9 +715,12 @@ void displayNoLogo() {
 
 // Save the system flags and overlay the "SAVED" message on the screen
 void saveFlags() {
+  arduboy.beginSystemEEPROMUpdate(); // write the flag changes together
   arduboy.writeShowUnitNameFlag(showNameFlag);
   arduboy.writeShowBootLogoFlag(showLogoFlag);
   arduboy.writeShowBootLogoLEDsFlag(showLEDsFlag);
+  arduboy.writeQuickBootLogoFlag(quickLogoFlag);
+  arduboy.commitSystemEEPROM();
   printStrLargeRev_P(FLAGS_SAVED_X, FLAGS_SAVED_Y, StrSaved);
   arduboy.display();
   arduboy.delayShort(1500);
@@ -719,6 +731,8 @@ void resetSysEEPROM() {
   for (unsigned int i = EEPROMstart; i < EEPROM_STORAGE_SPACE_START; i++) {
     EEPROM.update(i, 0xFF);
   }
+  // make the library reload its copy of the system EEPROM area
+  arduboy.discardSystemEEPROMChanges();
   arduboy.clear();
   printStrLargeRev_P(RESET_SYS_CONFIRMED_1_X, RESET_SYS_CONFIRMED_1_Y, StrSystem);
   printStrLargeRev_P(RESET_SYS_CONFIRMED_2_X, RESET_SYS_CONFIRMED_2_Y, StrEEPROM);
@@ -824,6 +838,13 @@ void printFlagSettings() {
     printStr_P(FLAGS_SET_X, FLAGS_NAME_Y, StrNo);
   }
 
+  if (quickLogoFlag) {
+    printStr_P(FLAGS_SET_X, FLAGS_QUICK_Y, StrYes);
+  }
+  else {
+    printStr_P(FLAGS_SET_X, FLAGS_QUICK_Y, StrNo);
+  }
+
   switch (currentFlag) {
    case SelectedFlag::selFlagLEDs:
     cursorY = FLAGS_LEDS_Y;
@@ -837,6 +858,12 @@ void printFlagSettings() {
       cursorLen = strlen_P(StrNo) * charWidth - charSpacing;
     }
     break;
+   case SelectedFlag::selFlagQuick:
+    cursorY = FLAGS_QUICK_Y;
+    if (!quickLogoFlag) {
+      cursorLen = strlen_P(StrNo) * charWidth - charSpacing;
+    }
+    break;
    default: // selFlagLogo
     cursorY = FLAGS_LOGO_Y;
     if (!showLogoFlag) {
@@ -1034,6 +1061,7 @@ void readEEPROM() {
   showLogoFlag = arduboy.readShowBootLogoFlag();
   showLEDsFlag = arduboy.readShowBootLogoLEDsFlag();
   showNameFlag = arduboy.readShowUnitNameFlag();
+  quickLogoFlag = arduboy.readQuickBootLogoFlag();
 }
 
 // Increment the name character at the cursor position
@@ -1119,6 +1147,9 @@ void flagsCursorDown() {
     currentFlag = SelectedFlag::selFlagName;
     break;
    case SelectedFlag::selFlagName:
+    currentFlag = SelectedFlag::selFlagQuick;
+    break;
+   case SelectedFlag::selFlagQuick:
     currentFlag = SelectedFlag::selFlagLogo;
     break;
   }
@@ -1128,6 +1159,9 @@ void flagsCursorDown() {
 // Move the Flags cursor up
 void flagsCursorUp() {
   switch (currentFlag) {
+   case SelectedFlag::selFlagQuick:
+    currentFlag = SelectedFlag::selFlagName;
+    break;
    case SelectedFlag::selFlagName:
     currentFlag = SelectedFlag::selFlagLEDs;
     break;
@@ -1135,7 +1169,7 @@ void flagsCursorUp() {
     currentFlag = SelectedFlag::selFlagLogo;
     break;
    case SelectedFlag::selFlagLogo:
-    currentFlag = SelectedFlag::selFlagName;
+    currentFlag = SelectedFlag::selFlagQuick;
     break;
   }
   drawScreen();
@@ -1153,6 +1187,9 @@ void flagToggle() {
    case SelectedFlag::selFlagName:
     showNameFlag = !showNameFlag;
     break;
+   case SelectedFlag::selFlagQuick:
+    quickLogoFlag = !quickLogoFlag;
+    break;
   }
   drawScreen();
 }
@@ -21,13 +21,15 @@ You should have received a copy of the CC0 Public Domain Dedication along with
 this software. If not, see <http://creativecommons.org/publicdomain/zero/1.0/>.
 
 Usage:
-cabi in.png [array_name_prefix]
+cabi [-f WxH [-m]] in.png [array_name_prefix]
+cabi -b out.h [-t PERCENT] in.png ...
 */
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <memory.h>
+#include <string.h>
 #include "lodepng/lodepng.h"
 
 // alternative pixel order mapping
@@ -197,7 +199,7 @@ static unsigned find_rlen(unsigned pos, unsigned plen)
 	col = getcol(pos);
 	pos0 = pos;
 
-	while(getcol(pos) == col && pos < plen)
+	while(pos < plen && getcol(pos) == col)
 		pos ++;
 
 	return pos-pos0;
@@ -211,9 +213,7 @@ static void putbit(unsigned val)
 	if (cs.bit == 0x100)
 	{
 		//output byte
-		if (cs.out_pos != 0) printf(",");
-		if (cs.out_pos % 16 == 0) printf("\n");
-		printf("0x%02x", cs.byte);
+		cs.dest[cs.out_pos] = cs.byte;
 
 		cs.out_pos ++;
 		cs.bit = 0x1;
@@ -253,17 +253,16 @@ static void putsplen(unsigned len)
 
 	compress plen 1-bit pixels from src to dest
 
+	dest must be large enough for the worst case of comp_max_len(w, h) bytes
 */
-unsigned compress_rle(const uint8_t *src, unsigned w, unsigned h, char *prefix, char *suffix)
+unsigned compress_rle(const uint8_t *src, unsigned w, unsigned h, uint8_t *dest)
 {
 	unsigned pos;
 	unsigned rlen;
 
-	printf("const PROGMEM uint8_t %s%s[] = {", prefix, suffix);
-	fflush(stdout);
-
 	memset(&cs, 0, sizeof(cs));
 	cs.src = src;
+	cs.dest = dest;
 	cs.bit = 1;
 	cs.w = w;
 	cs.h = h;
@@ -288,12 +287,691 @@ unsigned compress_rle(const uint8_t *src, unsigned w, unsigned h, char *prefix,
 	while (cs.bit != 0x1)
 		putbit(0);
 
-	printf("\n};\n");
-
 	return cs.out_pos; // bytes
 }
 
+// the maximum number of bytes compress_rle() can produce (each pixel being
+// its own span takes 2 bits) plus the header
+static unsigned comp_max_len(unsigned w, unsigned h)
+{
+	return (w * h) / 4 + 4;
+}
+
+
+// ----------------------------------------------------------------------------
+// :: Output
+// ----------------------------------------------------------------------------
+
+// write a byte to the array text, formatted 16 bytes per line
+static void print_byte(FILE *out, unsigned val, unsigned pos)
+{
+	if (pos != 0) fprintf(out, ",");
+	if (pos % 16 == 0) fprintf(out, "\n");
+	fprintf(out, "0x%02x", val);
+}
+
+// write len bytes of data as a C/C++ array named prefix followed by suffix
+static void print_array(FILE *out, const uint8_t *data, unsigned len,
+                        const char *prefix, const char *suffix)
+{
+	unsigned i;
+
+	fprintf(out, "const PROGMEM uint8_t %s%s[] = {", prefix, suffix);
+
+	for (i = 0; i < len; i++)
+		print_byte(out, data[i], i);
+
+	fprintf(out, "\n};\n");
+}
+
+
+// convert the area of a 32 bit RGBA image (of width w) starting at fx, fy
+// and of size fw by fh into a sprite and mask, in display order
+static void get_frame(const unsigned char *bmp, unsigned w,
+                      unsigned fx, unsigned fy, unsigned fw, unsigned fh,
+                      uint8_t *sprite, uint8_t *mask)
+{
+	unsigned x, y;
+	unsigned row, bit;
+	const unsigned char *pix;
+
+	memset(sprite, 0, fw * fh / 8);
+	memset(mask, 0, fw * fh / 8);
+
+	for (y = 0; y < fh; y++)
+	{
+		for (x = 0; x < fw; x++)
+		{
+			row = y/8;
+			bit = y&7;
+			pix = bmp + ((fx + x) + (fy + y) * w) * 4;
+
+			if (pix[3] > 127) // need to be opaque to count
+			if (pix[0] > 127)
+			{
+				// set sprite
+				sprite[x + (row*fw)] |= (1 << bit);
+			}
+
+			if (pix[3] > 127)
+			{
+				// set mask
+				mask[x + (row*fw)] |= (1 << bit);
+			}
+
+		}
+	}
+}
+
+/*
+	build_sheet
+
+	Compress each fw by fh frame of an image, in order left to right then top
+	to bottom, into a single sprite sheet array for the Arduboy2
+	Sprites::drawCompressedSelfMasked() and Sprites::drawCompressedMasked()
+	functions. The array is allocated and returned in *sheet_out, which must
+	be freed by the caller. If there isn't enough memory, *sheet_out is set
+	to NULL and 0 is returned.
+
+	Sheet format:
+	  byte 0: the number of frames
+	  byte 1: flags. bit 0 set if each frame includes a mask
+	  a table of 16 bit offsets (LSB first) from the start of the array to
+	    the compressed image of each frame, each followed by the offset to
+	    its mask if masks are included
+	  the compressed images and masks, in the drawCompressed() format
+*/
+static unsigned build_sheet(const unsigned char *bmp, unsigned w, unsigned h,
+                            unsigned fw, unsigned fh, unsigned with_mask,
+                            uint8_t **sheet_out)
+{
+	unsigned frames = (w / fw) * (h / fh);
+	unsigned entries = frames * (with_mask ? 2 : 1);
+	unsigned frame_len = fw * fh / 8;
+	unsigned pos, entry, f;
+	uint8_t *sheet;
+	uint8_t *sprite;
+	uint8_t *mask;
+
+	sheet = (uint8_t *)malloc(2 + (entries * 2) + (entries * comp_max_len(fw, fh)));
+	sprite = (uint8_t *)malloc(frame_len);
+	mask = (uint8_t *)malloc(frame_len);
+
+	if (sheet == NULL || sprite == NULL || mask == NULL)
+	{
+		free(sheet);
+		free(sprite);
+		free(mask);
+		*sheet_out = NULL;
+		return 0;
+	}
+
+	sheet[0] = frames;
+	sheet[1] = with_mask ? 0x01 : 0x00;
+	pos = 2 + (entries * 2);
+
+	for (f = 0; f < frames; f++)
+	{
+		get_frame(bmp, w, (f % (w / fw)) * fw, (f / (w / fw)) * fh, fw, fh,
+		          sprite, mask);
+
+		entry = f * (with_mask ? 2 : 1);
+		sheet[2 + (entry * 2)] = pos & 0xFF;
+		sheet[3 + (entry * 2)] = pos >> 8;
+		pos += compress_rle(sprite, fw, fh, sheet + pos);
+
+		if (with_mask)
+		{
+			entry++;
+			sheet[2 + (entry * 2)] = pos & 0xFF;
+			sheet[3 + (entry * 2)] = pos >> 8;
+			pos += compress_rle(mask, fw, fh, sheet + pos);
+		}
+	}
+
+	free(sprite);
+	free(mask);
+
+	*sheet_out = sheet;
+	return pos; // bytes
+}
+
+// build a sprite sheet and output it as an array named prefix
+static unsigned compress_sheet(const unsigned char *bmp, unsigned w, unsigned h,
+                               unsigned fw, unsigned fh, unsigned with_mask,
+                               char *prefix)
+{
+	uint8_t *sheet;
+	unsigned pos = build_sheet(bmp, w, h, fw, fh, with_mask, &sheet);
+
+	if (sheet == NULL)
+	{
+		printf("error 127: out of memory\n");
+		exit(127);
+	}
+
+	if (pos > 0xFFFF)
+	{
+		printf("error 123: sprite sheet size %u is larger than 65535 bytes\n", pos);
+		free(sheet);
+		return 0;
+	}
+
+	printf("// sprite sheet  frames: %u frame width: %u frame height: %u%s\n",
+	       (w / fw) * (h / fh), fw, fh, with_mask ? " with masks" : "");
+	print_array(stdout, sheet, pos, prefix, "");
+
+	free(sheet);
+
+	return pos; // bytes
+}
+
+// ----------------------------------------------------------------------------
+// :: Batch
+// ----------------------------------------------------------------------------
+
+/*
+	Batch mode converts many PNG files into a single header file. Each image
+	is output in whichever format is smallest:
+
+	  FMT_SPRITES    width, height and the image, for Sprites::drawOverwrite()
+	  FMT_PLUS_MASK  width, height and interleaved image and mask bytes, for
+	                 Sprites::drawPlusMask(). Used instead of FMT_SPRITES if
+	                 any pixel is transparent.
+	  FMT_COMP       drawCompressed() format
+	  FMT_COMP_MASK  a compressed sprite sheet of one frame with a mask, for
+	                 Sprites::drawCompressedMasked(). Used instead of FMT_COMP
+	                 if any pixel is transparent.
+
+	The compressed formats take much longer to draw, so a threshold can be
+	given. A compressed format is then only used if it's at least that
+	percentage smaller than the uncompressed one.
+
+	Each image's output is written between marker comments that record a
+	hash of the PNG file's contents and the threshold. When the header is
+	created again, the text for any image whose hash hasn't changed is
+	copied from the old header instead of being converted again.
+*/
+
+#define FMT_SPRITES 0
+#define FMT_PLUS_MASK 1
+#define FMT_COMP 2
+#define FMT_COMP_MASK 3
+
+static const char *format_names[] = {
+	"Sprites", "Sprites plus mask", "compressed", "compressed with mask"
+};
+
+static const char *format_draw[] = {
+	"Sprites::drawOverwrite() or Sprites::drawSelfMasked()",
+	"Sprites::drawPlusMask()",
+	"Arduboy2Base::drawCompressed()",
+	"Sprites::drawCompressedMasked() with frame 0"
+};
+
+#define MAX_NAME 64
+
+typedef struct ASSET{
+	char name[MAX_NAME];
+	unsigned long hash;
+	unsigned format;
+	unsigned bytes;     // the size of the array output
+	unsigned raw_bytes; // the size in the uncompressed format
+	const char *text;   // for a cached asset, its text in the old header
+	unsigned text_len;
+}ASSET;
+
+// 32 bit FNV-1a hash
+static unsigned long hash_bytes(unsigned long hash, const unsigned char *p, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+	{
+		hash ^= p[i];
+		hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+}
+
+// make a C identifier from a file name, without its directory or extension
+static void symbol_name(const char *file, char *name)
+{
+	const char *start = file;
+	const char *end;
+	const char *p;
+	unsigned n = 0;
+
+	for (p = file; *p; p++)
+	{
+		if (*p == '/' || *p == '\\')
+			start = p + 1;
+	}
+	end = strrchr(start, '.');
+	if (end == NULL)
+		end = start + strlen(start);
+
+	if (start == end || (*start >= '0' && *start <= '9'))
+		name[n++] = '_';
+
+	for (p = start; p < end && n < MAX_NAME - 1; p++)
+	{
+		if ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') ||
+		    (*p >= '0' && *p <= '9'))
+			name[n++] = *p;
+		else
+			name[n++] = '_';
+	}
+	name[n] = '\0';
+}
+
+// read a whole file into an allocated, null terminated buffer.
+// returns NULL if the file can't be read.
+static char *read_text_file(const char *file)
+{
+	FILE *f = fopen(file, "rb");
+	char *text;
+	long len;
+
+	if (f == NULL)
+		return NULL;
+
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	text = (char *)malloc(len + 1);
+	if (text == NULL || len < 0 || fread(text, 1, len, f) != (size_t)len)
+	{
+		free(text);
+		fclose(f);
+		return NULL;
+	}
+	text[len] = '\0';
+	fclose(f);
+
+	return text;
+}
+
+static const char cache_start[] = "// cabi asset: ";
+static const char cache_end[] = "// cabi end\n";
+
+// count the assets output by an earlier run in the text of its header
+static unsigned count_cached(const char *text)
+{
+	const char *p = text;
+	unsigned count = 0;
+
+	while ((p = strstr(p, cache_start)) != NULL)
+	{
+		count++;
+		p++;
+	}
+	return count;
+}
+
+// find the assets output by an earlier run in the text of its header.
+// returns the number found, up to max.
+static unsigned find_cached(const char *text, ASSET *cached, unsigned max)
+{
+	const char *p = text;
+	const char *end;
+	unsigned count = 0;
+	ASSET *a;
+
+	while (count < max && (p = strstr(p, cache_start)) != NULL)
+	{
+		a = &cached[count];
+		end = strstr(p, cache_end);
+		if (end == NULL)
+			break;
+		end += strlen(cache_end);
+
+		if (sscanf(p, "// cabi asset: %63s hash: %lx format: %u bytes: %u raw: %u",
+		           a->name, &a->hash, &a->format, &a->bytes, &a->raw_bytes) == 5 &&
+		    a->format <= FMT_COMP_MASK)
+		{
+			a->text = p;
+			a->text_len = end - p;
+			count++;
+		}
+		p = end;
+	}
+	return count;
+}
+
+/*
+	convert_asset
+
+	Convert one decoded image to the best format and write it to out.
+	Returns 0 on success, or an error number.
+*/
+static unsigned convert_asset(FILE *out, ASSET *a, const char *file,
+                              const unsigned char *bmp, unsigned w, unsigned h,
+                              unsigned threshold)
+{
+	unsigned rawlen = w * h / 8;
+	unsigned transparent = 0;
+	unsigned comp_len;
+	unsigned i;
+	uint8_t *sprite = (uint8_t *)malloc(rawlen);
+	uint8_t *mask = (uint8_t *)malloc(rawlen);
+	uint8_t *comp = NULL;
+	uint8_t *raw = NULL;
+
+	if (sprite == NULL || mask == NULL)
+		goto out_of_memory;
+
+	get_frame(bmp, w, 0, 0, w, h, sprite, mask);
+
+	for (i = 0; i < rawlen; i++)
+	{
+		if (mask[i] != 0xFF)
+			transparent = 1;
+	}
+
+	// the compressed candidate
+	if (transparent)
+	{
+		comp_len = build_sheet(bmp, w, h, w, h, 1, &comp);
+	}
+	else
+	{
+		comp = (uint8_t *)malloc(comp_max_len(w, h));
+		if (comp != NULL)
+			comp_len = compress_rle(sprite, w, h, comp);
+	}
+	if (comp == NULL)
+		goto out_of_memory;
+
+	// the uncompressed candidate, which needs the width and height to fit
+	// in a byte
+	raw = (uint8_t *)malloc(2 + (rawlen * 2));
+	if (raw == NULL)
+		goto out_of_memory;
+	raw[0] = w;
+	raw[1] = h;
+	a->raw_bytes = 2 + (transparent ? rawlen * 2 : rawlen);
+	if (transparent)
+	{
+		for (i = 0; i < rawlen; i++)
+		{
+			raw[2 + (i * 2)] = sprite[i];
+			raw[3 + (i * 2)] = mask[i];
+		}
+	}
+	else
+	{
+		memcpy(raw + 2, sprite, rawlen);
+	}
+
+	// with a threshold, saving exactly that much is enough. Without one, the
+	// compressed array must be smaller, since a tie isn't worth the slower
+	// drawing
+	if (w > 255 || h > 255 ||
+	    (threshold > 0 ?
+	     comp_len * 100 <= a->raw_bytes * (100 - threshold) :
+	     comp_len < a->raw_bytes))
+	{
+		if (comp_len > 0xFFFF)
+		{
+			printf("error 123: file %s: compressed size %u is larger than 65535 bytes\n", file, comp_len);
+			free(sprite);
+			free(mask);
+			free(comp);
+			free(raw);
+			return 123;
+		}
+		a->format = transparent ? FMT_COMP_MASK : FMT_COMP;
+		a->bytes = comp_len;
+	}
+	else
+	{
+		a->format = transparent ? FMT_PLUS_MASK : FMT_SPRITES;
+		a->bytes = a->raw_bytes;
+	}
+
+	fprintf(out, "%s%s hash: %08lx format: %u bytes: %u raw: %u\n",
+	        cache_start, a->name, a->hash, a->format, a->bytes, a->raw_bytes);
+	fprintf(out, "// %s  width: %u height: %u\n", file, w, h);
+	fprintf(out, "// %s format, for %s\n", format_names[a->format],
+	        format_draw[a->format]);
+	print_array(out, (a->format >= FMT_COMP) ? comp : raw, a->bytes, a->name, "");
+	fprintf(out, "%s\n", cache_end);
+
+	free(sprite);
+	free(mask);
+	free(comp);
+	free(raw);
+
+	return 0;
+
+out_of_memory:
+	printf("error 127: file %s: out of memory\n", file);
+	free(sprite);
+	free(mask);
+	free(comp);
+	free(raw);
+	return 127;
+}
+
+// write the size of each asset and the total, as comment lines
+static void print_report(FILE *out, const ASSET *assets, unsigned count)
+{
+	unsigned long total = 0;
+	unsigned long raw_total = 0;
+	unsigned i;
+
+	fprintf(out, "// %-31s %-20s %6s %6s\n", "name", "format", "bytes", "raw");
+	for (i = 0; i < count; i++)
+	{
+		fprintf(out, "// %-31s %-20s %6u %6u\n", assets[i].name,
+		        format_names[assets[i].format], assets[i].bytes,
+		        assets[i].raw_bytes);
+		total += assets[i].bytes;
+		raw_total += assets[i].raw_bytes;
+	}
+	fprintf(out, "// %-31s %-20s %6lu %6lu\n", "total", "", total, raw_total);
+}
+
+/*
+	batch
+
+	Convert the count PNG files named in files into the header file named
+	header. Returns 0 on success, or an error number.
+*/
+static int batch(const char *header, char **files, unsigned count,
+                 unsigned threshold)
+{
+	ASSET *assets = (ASSET *)calloc(count, sizeof(ASSET));
+	ASSET *cached = NULL;
+	char *old_text = read_text_file(header);
+	char *temp_name = (char *)malloc(strlen(header) + 5);
+	unsigned cached_count = 0;
+	unsigned converted = 0;
+	unsigned result = 0;
+	unsigned i, j;
+	char guard[MAX_NAME];
+	FILE *out;
+
+	if (old_text != NULL)
+	{
+		cached_count = count_cached(old_text);
+		cached = (ASSET *)calloc(cached_count + 1, sizeof(ASSET));
+		if (cached != NULL)
+			cached_count = find_cached(old_text, cached, cached_count);
+	}
+
+	// nothing has been written yet, so there's no temporary file to remove
+	if (assets == NULL || temp_name == NULL ||
+	    (old_text != NULL && cached == NULL))
+	{
+		printf("error 127: out of memory\n");
+		result = 127;
+		goto done;
+	}
+
+	// check the names before overwriting anything
+	for (i = 0; i < count; i++)
+	{
+		symbol_name(files[i], assets[i].name);
+		for (j = 0; j < i; j++)
+		{
+			if (strcmp(assets[i].name, assets[j].name) == 0)
+			{
+				printf("error 125: files %s and %s both give the array name %s\n",
+				       files[j], files[i], assets[i].name);
+				result = 125;
+				goto done;
+			}
+		}
+	}
+
+	// the header is written to a temporary file first, so that it's left
+	// unchanged if there's an error
+	sprintf(temp_name, "%s.tmp", header);
+	out = fopen(temp_name, "wb");
+	if (out == NULL)
+	{
+		printf("error 124: file %s: can't be written\n", temp_name);
+		result = 124;
+		goto done;
+	}
+
+	symbol_name(header, guard);
+	for (i = 0; guard[i]; i++)
+	{
+		if (guard[i] >= 'a' && guard[i] <= 'z')
+			guard[i] -= 'a' - 'A';
+	}
+
+	fprintf(out, "// Generated by cabi from %u PNG file%s. Do not edit.\n\n",
+	        count, (count == 1) ? "" : "s");
+	fprintf(out, "#ifndef %s_H\n#define %s_H\n\n", guard, guard);
+	fprintf(out, "#include <avr/pgmspace.h>\n\n");
+
+	for (i = 0; i < count && result == 0; i++)
+	{
+		ASSET *a = &assets[i];
+		unsigned char *png = NULL;
+		unsigned char *bmp = NULL;
+		size_t png_len;
+		unsigned w, h;
+		unsigned char t = threshold;
+
+		result = lodepng_load_file(&png, &png_len, files[i]);
+		if (result != 0)
+		{
+			printf("error %u: file %s: %s\n", result, files[i], lodepng_error_text(result));
+			free(png);
+			break;
+		}
+
+		a->hash = hash_bytes(2166136261UL, png, png_len);
+		a->hash = hash_bytes(a->hash, &t, 1);
+
+		for (j = 0; j < cached_count; j++)
+		{
+			if (cached[j].hash == a->hash && strcmp(cached[j].name, a->name) == 0)
+				break;
+		}
+
+		if (j < cached_count)
+		{
+			// unchanged since the header was last created
+			fwrite(cached[j].text, 1, cached[j].text_len, out);
+			fprintf(out, "\n");
+			a->format = cached[j].format;
+			a->bytes = cached[j].bytes;
+			a->raw_bytes = cached[j].raw_bytes;
+			free(png);
+			continue;
+		}
 
+		result = lodepng_decode32(&bmp, &w, &h, png, png_len);
+		free(png);
+
+		if (result != 0)
+		{
+			printf("error %u: file %s: %s\n", result, files[i], lodepng_error_text(result));
+		}
+		else if (h % 8 != 0)
+		{
+			printf("error 120: file %s: image height must be a multiple of 8 but is %u\n", files[i], h);
+			result = 120;
+		}
+		else if (w > 256 || h > 256)
+		{
+			printf("error 126: file %s: image size %ux%u is larger than 256x256\n", files[i], w, h);
+			result = 126;
+		}
+		else
+		{
+			result = convert_asset(out, a, files[i], bmp, w, h, threshold);
+			converted++;
+		}
+		free(bmp);
+	}
+
+	if (result == 0)
+	{
+		fprintf(out, "// Size report, in bytes\n");
+		print_report(out, assets, count);
+		fprintf(out, "\n#endif\n");
+
+	}
+	if (fclose(out) != 0 && result == 0)
+	{
+		printf("error 124: file %s: can't be written\n", temp_name);
+		result = 124;
+	}
+
+	if (result == 0)
+	{
+		remove(header);
+		if (rename(temp_name, header) != 0)
+		{
+			printf("error 124: file %s: can't be written\n", header);
+			result = 124;
+		}
+	}
+	if (result != 0)
+	{
+		remove(temp_name);
+		goto done;
+	}
+
+	print_report(stdout, assets, count);
+	printf("// %u converted, %u unchanged\n", converted, count - converted);
+
+done:
+	free(assets);
+	free(cached);
+	free(old_text);
+	free(temp_name);
+
+	return result;
+}
+
+static void usage(void)
+{
+	printf("cabi - Compress Arduboy Image\n");
+	printf("Convert a PNG file into RLE encoded C/C++ source\n");
+	printf("for use with Arduboy2 drawCompressed()\n\n");
+
+	printf("usage: cabi [-f WxH [-m]] in.png [array_name_prefix]\n");
+	printf("       cabi -b out.h [-t PERCENT] in.png ...\n\n");
+	printf("  -f WxH      create a sprite sheet of frames W by H pixels\n");
+	printf("              for Arduboy2 Sprites::drawCompressedSelfMasked()\n");
+	printf("  -m          include a mask with each sprite sheet frame\n");
+	printf("              for Arduboy2 Sprites::drawCompressedMasked()\n");
+	printf("  -b out.h    convert all the files named after it (a list, or a\n");
+	printf("              wildcard such as images/*.png, not a directory)\n");
+	printf("              into header out.h, each in the smallest format,\n");
+	printf("              skipping unchanged files\n");
+	printf("  -t PERCENT  only use a compressed format if it's at least\n");
+	printf("              PERCENT smaller than the uncompressed one\n");
+}
 
 int main(int argc, char **argv)
 {
@@ -302,84 +980,130 @@ int main(int argc, char **argv)
 	unsigned char *bmp = NULL;
 	unsigned char *bmp0 = NULL;
 	unsigned char *bmp1 = NULL;
+	uint8_t *out = NULL;
 	unsigned result;
 	unsigned rawlen;
-	unsigned x, y;
-	unsigned row, bit;
+	unsigned fw = 0, fh = 0;
+	unsigned with_mask = 0;
+	unsigned threshold = 0;
+	char *header = NULL;
+	int arg = 1;
 	char default_prefix[] = "compressed_image";
 	char *prefix = default_prefix;
 
-
-	if (argc < 2)
+	while (arg < argc && argv[arg][0] == '-')
 	{
-		printf("cabi - Compress Arduboy Image\n");
-		printf("Convert a PNG file into RLE encoded C/C++ source\n");
-		printf("for use with Arduboy2 drawCompressed()\n\n");
+		if (strcmp(argv[arg], "-f") == 0 && arg + 1 < argc &&
+		    sscanf(argv[arg + 1], "%ux%u", &fw, &fh) == 2)
+		{
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-m") == 0)
+		{
+			with_mask = 1;
+			arg++;
+		}
+		else if (strcmp(argv[arg], "-b") == 0 && arg + 1 < argc)
+		{
+			header = argv[arg + 1];
+			arg += 2;
+		}
+		else if (strcmp(argv[arg], "-t") == 0 && arg + 1 < argc &&
+		         sscanf(argv[arg + 1], "%u", &threshold) == 1 && threshold < 100)
+		{
+			arg += 2;
+		}
+		else
+		{
+			usage();
+			exit(1);
+		}
+	}
 
-		printf("usage: cabi in.png [array_name_prefix]\n");
+	if (arg >= argc || (with_mask && fw == 0) ||
+	    (header != NULL && fw != 0) || (header == NULL && threshold != 0))
+	{
+		usage();
 		exit(1);
 	}
 
-	if (argc >= 3) {
-		prefix = argv[2];
+	if (header != NULL)
+		return batch(header, argv + arg, argc - arg, threshold);
+
+	if (arg + 1 < argc) {
+		prefix = argv[arg + 1];
 	}
 
-	result = lodepng_decode32_file(&bmp, &w, &h, argv[1]);
+	result = lodepng_decode32_file(&bmp, &w, &h, argv[arg]);
 
 	if (result != 0) {
-		printf("error %u: file %s: %s\n", result, argv[1], lodepng_error_text(result));
+		printf("error %u: file %s: %s\n", result, argv[arg], lodepng_error_text(result));
 		free(bmp);
 		exit(result);
 	}
 
 	if (h % 8 != 0) {
-		printf("error 120: file %s: image height must be a multiple of 8 but is %u\n", argv[1], h);
+		printf("error 120: file %s: image height must be a multiple of 8 but is %u\n", argv[arg], h);
 		free(bmp);
 		exit(120);
 	}
 
-	// generate sprite and mask
+	if (fw != 0)
+	{
+		// sprite sheet
 
-	rawlen = w * (h+7) / 8;
+		if (fw > 256 || fh == 0 || fh > 256 || fh % 8 != 0 ||
+		    w % fw != 0 || h % fh != 0)
+		{
+			printf("error 121: file %s: frame size %ux%u must divide the image evenly, be no larger than 256x256 and have a height that is a multiple of 8\n", argv[arg], fw, fh);
+			free(bmp);
+			exit(121);
+		}
 
-	bmp0 = (unsigned char *)malloc(rawlen); memset(bmp0, 0, rawlen);
-	bmp1 = (unsigned char *)malloc(rawlen); memset(bmp1, 0, rawlen);
+		if ((w / fw) * (h / fh) > 255)
+		{
+			printf("error 122: file %s: %u frames is more than the maximum of 255\n", argv[arg], (w / fw) * (h / fh));
+			free(bmp);
+			exit(122);
+		}
 
-	printf("// %s  width: %u height: %u\n", argv[1], w, h);
+		printf("// %s  width: %u height: %u\n", argv[arg], w, h);
+		compressed_len = compress_sheet(bmp, w, h, fw, fh, with_mask, prefix);
+		free(bmp);
 
-	for (y = 0; y < h; y++)
-	{
-		for (x = 0; x < w; x++)
-		{
-			row = y/8;
-			bit = y&7;
-			
-			if (bmp[(x+y*w)*4 + 3] > 127) // need to be opaque to count
-			if (bmp[(x+y*w)*4 + 0] > 127)
-			{
-				// set sprite
-				bmp0[x + (row*w)] |= (1 << bit);
-			}
-			
-			if (bmp[(x+y*w)*4 + 3] > 127)
-			{
-				// set mask
-				bmp1[x + (row*w)] |= (1 << bit);
-			}
+		if (compressed_len == 0)
+			exit(123);
 
-		}
+		printf("// bytes:%u ratio: %3.3f\n\n", compressed_len,
+		       (float)(compressed_len * 8) / (float)(w * h * (with_mask ? 2 : 1)));
+		return 0;
 	}
 
-	compressed_len = compress_rle(bmp0, w, h, prefix, "");
+	// generate sprite and mask
+
+	rawlen = w * (h+7) / 8;
+
+	bmp0 = (unsigned char *)malloc(rawlen);
+	bmp1 = (unsigned char *)malloc(rawlen);
+	out = (uint8_t *)malloc(comp_max_len(w, h));
+
+	printf("// %s  width: %u height: %u\n", argv[arg], w, h);
+
+	get_frame(bmp, w, 0, 0, w, h, bmp0, bmp1);
+
+	compressed_len = compress_rle(bmp0, w, h, out);
+	print_array(stdout, out, compressed_len, prefix, "");
 	printf("// bytes:%u ratio: %3.3f\n\n", compressed_len, (float)(compressed_len * 8)/ (float)(w*h));
 
-	compressed_len = compress_rle(bmp1, w, h, prefix, "_mask");
+	compressed_len = compress_rle(bmp1, w, h, out);
+	print_array(stdout, out, compressed_len, prefix, "_mask");
 	printf("// bytes:%u ratio: %3.3f\n\n", compressed_len, (float)(compressed_len * 8)/ (float)(w*h));
 
 
 	free(bmp);
 	free(bmp0);
 	free(bmp1);
+	free(out);
 
 	return 0;
 }
@@ -21,6 +21,24 @@ uint8_t Arduboy2Base::eachFrameMillis = 16;
 uint8_t Arduboy2Base::thisFrameStart;
 uint8_t Arduboy2Base::lastFrameDurationMs;
 bool Arduboy2Base::justRendered = false;
+uint16_t Arduboy2Base::nextStepTime;
+uint8_t Arduboy2Base::viewStart = 0;
+bool Arduboy2Base::viewStartChanged = false;
+uint16_t Arduboy2Base::fastRandomState = 1;
+uint8_t Arduboy2Base::sysEEPROM[];
+bool Arduboy2Base::sysEEPROMLoaded = false;
+bool Arduboy2Base::sysEEPROMDeferred = false;
+uint16_t Arduboy2Base::sysEEPROMChanged = 0;
+uint8_t Arduboy2Base::grayPlane = 0;
+uint8_t Arduboy2Base::grayPlaneCount = 1;
+
+// Boot logo sequence settings used when the "Quick boot logo" flag is set
+// in system EEPROM
+static constexpr uint8_t quickLogoStep = 4;      // pixels per scroll step
+static constexpr uint16_t quickLogoHold = 100;   // ms after scrolling
+static constexpr uint16_t quickUnitNameHold = 250; // ms to show unit name
+static constexpr uint8_t quickLogoAbortButtons =
+  UP_BUTTON | DOWN_BUTTON | LEFT_BUTTON | RIGHT_BUTTON | A_BUTTON | B_BUTTON;
 
 // functions called here should be public so users can create their
 // own init functions if they need different behavior than `begin`
@@ -43,6 +61,8 @@ void Arduboy2Base::begin()
 //  bootLogoSpritesBOverwrite();
 
   waitNoButtons(); // wait for all buttons to be released
+
+  nextStepTime = millis(); // nextFrameSteps() timing starts now
 }
 
 void Arduboy2Base::beginDoFirst()
@@ -98,7 +118,7 @@ void Arduboy2Base::sysCtrlSound(uint8_t buttons, uint8_t led, uint8_t eeVal)
     digitalWriteRGB(BLUE_LED, RGB_OFF); // turn off blue LED
     delayShort(200);
     digitalWriteRGB(led, RGB_ON); // turn on "acknowledge" LED
-    EEPROM.update(eepromAudioOnOff, eeVal);
+    writeSysEEPROM(eepromAudioOnOff, eeVal);
     delayShort(500);
     digitalWriteRGB(led, RGB_OFF); // turn off "acknowledge" LED
 
@@ -171,6 +191,7 @@ void Arduboy2Base::drawLogoSpritesBOverwrite(int16_t y)
 bool Arduboy2Base::bootLogoShell(void (&drawLogo)(int16_t))
 {
   bool showLEDs = readShowBootLogoLEDsFlag();
+  bool quick = readQuickBootLogoFlag();
 
   if (!readShowBootLogoFlag()) {
     return false;
@@ -180,8 +201,10 @@ bool Arduboy2Base::bootLogoShell(void (&drawLogo)(int16_t))
     digitalWriteRGB(RED_LED, RGB_ON);
   }
 
-  for (int16_t y = -15; y <= 24; y++) {
-    if (pressed(RIGHT_BUTTON)) {
+  // a quick sequence starts one pixel higher so it still ends at 24
+  for (int16_t y = quick ? -16 : -15; y <= 24;
+       y += quick ? quickLogoStep : 1) {
+    if (anyPressed(quick ? quickLogoAbortButtons : RIGHT_BUTTON)) {
       digitalWriteRGB(RGB_OFF, RGB_OFF, RGB_OFF); // all LEDs off
       return false;
     }
@@ -203,7 +226,7 @@ bool Arduboy2Base::bootLogoShell(void (&drawLogo)(int16_t))
     digitalWriteRGB(GREEN_LED, RGB_OFF);  // green LED off
     digitalWriteRGB(BLUE_LED, RGB_ON);    // blue LED on
   }
-  delayShort(400);
+  delayShort(quick ? quickLogoHold : 400);
   digitalWriteRGB(BLUE_LED, RGB_OFF);
 
   return true;
@@ -275,6 +298,51 @@ bool Arduboy2Base::nextFrameDEV()
   return ret;
 }
 
+uint8_t Arduboy2Base::nextFrameSteps(uint8_t maxSteps)
+{
+  uint16_t now = millis();
+  int16_t late = now - nextStepTime;
+  uint8_t steps;
+
+  if (maxSteps == 0) {
+    maxSteps = 1;
+  }
+
+  if (justRendered) {
+    lastFrameDurationMs = (uint8_t) now - thisFrameStart;
+    justRendered = false;
+    return 0;
+  }
+  else if (late < 0 && late >= -(int16_t) eachFrameMillis) {
+    // Only idle if at least a full millisecond remains, since idle() may
+    // sleep the processor until the next millisecond timer interrupt.
+    if (late < -1) {
+      idle();
+    }
+
+    return 0;
+  }
+
+  if ((uint16_t) late >= (uint16_t) maxSteps * eachFrameMillis) {
+    // Too far behind to catch up, so drop the extra steps. This also
+    // restarts the timing if not called for so long that millis() has
+    // wrapped around.
+    steps = maxSteps;
+    nextStepTime = now + eachFrameMillis;
+  }
+  else {
+    steps = (uint16_t) late / eachFrameMillis + 1;
+    nextStepTime += steps * eachFrameMillis;
+  }
+
+  // pre-render
+  justRendered = true;
+  thisFrameStart = now;
+  frameCount++;
+
+  return steps;
+}
+
 int Arduboy2Base::cpuLoad()
 {
   return lastFrameDurationMs*100 / eachFrameMillis;
@@ -285,6 +353,53 @@ void Arduboy2Base::initRandomSeed()
   randomSeed(generateRandomSeed());
 }
 
+void Arduboy2Base::initFastRandomSeed()
+{
+  unsigned long seed = generateRandomSeed();
+
+  // fold all the entropy into the 16 bit state
+  setFastRandomSeed((uint16_t)seed ^ (uint16_t)(seed >> 16));
+}
+
+void Arduboy2Base::setFastRandomSeed(uint16_t seed)
+{
+  // the generator would only ever produce 0 from a state of 0
+  fastRandomState = (seed == 0) ? 1 : seed;
+}
+
+uint16_t Arduboy2Base::fastRandom()
+{
+  // xorshift with shift amounts 7, 9, 8. The last shift is done on whole
+  // bytes.
+  uint16_t x = fastRandomState;
+
+  x ^= x << 7;
+  x ^= x >> 9;
+  x ^= x << 8;
+  fastRandomState = x;
+  return x;
+}
+
+uint8_t Arduboy2Base::fastRandom(uint8_t limit)
+{
+  // scale the high byte, which has the best randomness, to the range
+  return ((uint8_t)(fastRandom() >> 8) * limit) >> 8;
+}
+
+int16_t Arduboy2Base::fastRandom(int16_t min, int16_t max)
+{
+  if (max <= min)
+  {
+    return min;
+  }
+
+  // unsigned, so that ranges over 32767 don't overflow
+  uint16_t range = (uint16_t)max - (uint16_t)min;
+  uint16_t offset = ((uint32_t)fastRandom() * range) >> 16;
+
+  return (int16_t)((uint16_t)min + offset);
+}
+
 /* Graphics */
 
 void Arduboy2Base::clear()
@@ -361,54 +476,45 @@ uint8_t Arduboy2Base::getPixel(uint8_t x, uint8_t y)
 
 void Arduboy2Base::drawCircle(int16_t x0, int16_t y0, uint8_t r, uint8_t color)
 {
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
+  uint8_t clip = clipShape(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
 
-  drawPixel(x0, y0+r, color);
-  drawPixel(x0, y0-r, color);
-  drawPixel(x0+r, y0, color);
-  drawPixel(x0-r, y0, color);
-
-  while (x<y)
-  {
-    if (f >= 0)
-    {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
+  if (clip == shapeHidden)
+    return;
 
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
+  // the points on the axes, which the corners leave out
+  fillSpan(x0, y0 + r, 1, 1, color, clip);
+  if (r == 0)
+    return;
+  fillSpan(x0, y0 - r, 1, 1, color, clip);
+  fillSpan(x0 + r, y0, 1, 1, color, clip);
+  fillSpan(x0 - r, y0, 1, 1, color, clip);
 
-    drawPixel(x0 + x, y0 + y, color);
-    drawPixel(x0 - x, y0 + y, color);
-    drawPixel(x0 + x, y0 - y, color);
-    drawPixel(x0 - x, y0 - y, color);
-    drawPixel(x0 + y, y0 + x, color);
-    drawPixel(x0 - y, y0 + x, color);
-    drawPixel(x0 + y, y0 - x, color);
-    drawPixel(x0 - y, y0 - x, color);
-  }
+  drawCircleHelper(x0, y0, r, 0x0F, color);
 }
 
 void Arduboy2Base::drawCircleHelper
 (int16_t x0, int16_t y0, uint8_t r, uint8_t corners, uint8_t color)
 {
+  uint8_t clip = clipShape(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
+
+  if (clip == shapeHidden)
+    return;
+
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
   int16_t x = 0;
   int16_t y = r;
+  uint8_t runStart = 1;
 
+  // Points with the same y are drawn together, as horizontal spans at the
+  // top and bottom of the circle and vertical spans at the sides.
   while (x<y)
   {
     if (f >= 0)
     {
+      drawCircleRun(x0, y0, runStart, x, y, corners, color, clip);
+      runStart = x + 1;
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -417,27 +523,47 @@ void Arduboy2Base::drawCircleHelper
     x++;
     ddF_x += 2;
     f += ddF_x;
+  }
+  drawCircleRun(x0, y0, runStart, x, y, corners, color, clip);
+}
 
-    if (corners & 0x4) // lower right
-    {
-      drawPixel(x0 + x, y0 + y, color);
-      drawPixel(x0 + y, y0 + x, color);
-    }
-    if (corners & 0x2) // upper right
-    {
-      drawPixel(x0 + x, y0 - y, color);
-      drawPixel(x0 + y, y0 - x, color);
-    }
-    if (corners & 0x8) // lower left
-    {
-      drawPixel(x0 - y, y0 + x, color);
-      drawPixel(x0 - x, y0 + y, color);
-    }
-    if (corners & 0x1) // upper left
-    {
-      drawPixel(x0 - y, y0 - x, color);
-      drawPixel(x0 - x, y0 - y, color);
-    }
+// draw the points from xStart to xEnd, at distance y from the center, of
+// the given corners of a circle. Each pixel is only drawn once, so INVERT
+// works: the horizontal spans stop at the diagonal and the vertical spans
+// stop just before it.
+void Arduboy2Base::drawCircleRun
+(int16_t x0, int16_t y0, uint8_t xStart, uint8_t xEnd, uint8_t y,
+ uint8_t corners, uint8_t color, uint8_t clip)
+{
+  uint8_t hEnd = (xEnd < y) ? xEnd : y;
+  uint8_t vEnd = (xEnd < y) ? xEnd : y - 1;
+
+  if (xStart > hEnd)
+    return;
+
+  uint8_t hLen = hEnd - xStart + 1;
+  // the vertical span is empty if the run starts on the diagonal
+  uint8_t vLen = (xStart > vEnd) ? 0 : vEnd - xStart + 1;
+
+  if (corners & 0x4) // lower right
+  {
+    fillSpan(x0 + xStart, y0 + y, hLen, 1, color, clip);
+    fillSpan(x0 + y, y0 + xStart, 1, vLen, color, clip);
+  }
+  if (corners & 0x2) // upper right
+  {
+    fillSpan(x0 + xStart, y0 - y, hLen, 1, color, clip);
+    fillSpan(x0 + y, y0 - vEnd, 1, vLen, color, clip);
+  }
+  if (corners & 0x8) // lower left
+  {
+    fillSpan(x0 - y, y0 + xStart, 1, vLen, color, clip);
+    fillSpan(x0 - hEnd, y0 + y, hLen, 1, color, clip);
+  }
+  if (corners & 0x1) // upper left
+  {
+    fillSpan(x0 - y, y0 - vEnd, 1, vLen, color, clip);
+    fillSpan(x0 - hEnd, y0 - y, hLen, 1, color, clip);
   }
 }
 
@@ -451,16 +577,29 @@ void Arduboy2Base::fillCircleHelper
 (int16_t x0, int16_t y0, uint8_t r, uint8_t sides, int16_t delta,
  uint8_t color)
 {
+  // a negative delta can only come from a badly sized rounded rectangle, so
+  // let the spans be clipped individually
+  uint8_t clip = (delta < 0) ? shapeClipped :
+                 clipShape(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1 + delta);
+
+  if (clip == shapeHidden)
+    return;
+
   int16_t f = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
   int16_t x = 0;
   int16_t y = r;
 
+  // Each column is filled only once, so INVERT works. Column x is filled
+  // at each step. Column y is filled at the last step before y changes,
+  // when its height is greatest, unless it's also reached as column x.
   while (x < y)
   {
     if (f >= 0)
     {
+      if (y > x + 1)
+        fillCircleColumns(x0, y0, y, x, sides, delta, color, clip);
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -470,23 +609,86 @@ void Arduboy2Base::fillCircleHelper
     ddF_x += 2;
     f += ddF_x;
 
-    if (sides & 0x1) // right side
-    {
-      drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
-      drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
-    }
-
-    if (sides & 0x2) // left side
-    {
-      drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
-      drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
-    }
+    fillCircleColumns(x0, y0, x, y, sides, delta, color, clip);
   }
 }
 
+// fill the column(s) at distance dx from the center of a filled-in circle,
+// from dy above the center to dy + delta below it
+void Arduboy2Base::fillCircleColumns
+(int16_t x0, int16_t y0, uint8_t dx, uint8_t dy, uint8_t sides,
+ int16_t delta, uint8_t color, uint8_t clip)
+{
+  uint8_t h = 2*dy+1+delta;
+
+  if (sides & 0x1) // right side
+    fillSpan(x0+dx, y0-dy, 1, h, color, clip);
+
+  if (sides & 0x2) // left side
+    fillSpan(x0-dx, y0-dy, 1, h, color, clip);
+}
+
+// check a whole shape against the screen, so that the spans it's drawn with
+// don't each have to be clipped
+uint8_t Arduboy2Base::clipShape(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if (x + w <= 0 || x >= WIDTH || y + h <= 0 || y >= HEIGHT)
+    return shapeHidden;
+
+  if (x < 0 || x + w > WIDTH || y < 0 || y + h > HEIGHT)
+    return shapeClipped;
+
+  // the spans don't mark what they change, so do it for the whole shape
+  expandDirty(x, x + w - 1, y / 8, (y + h - 1) / 8);
+  return shapeVisible;
+}
+
+// fill part of a shape checked by clipShape()
+void Arduboy2Base::fillSpan
+(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color, uint8_t clip)
+{
+  if (w == 0 || h == 0)
+    return;
+
+  if (clip == shapeVisible)
+    fillRectUnclipped(x, y, w, h, color);
+  else
+    fillRect(x, y, w, h, color);
+}
+
 void Arduboy2Base::drawLine
 (int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
 {
+  // horizontal and vertical lines are clipped to the screen, so their
+  // lengths fit the fast line functions
+  if (y0 == y1)
+  {
+    if (x0 > x1)
+      swapInt16(x0, x1);
+    if (y0 < 0 || y0 >= HEIGHT || x1 < 0 || x0 >= WIDTH)
+      return;
+    if (x0 < 0)
+      x0 = 0;
+    if (x1 >= WIDTH)
+      x1 = WIDTH - 1;
+    drawFastHLine(x0, y0, x1 - x0 + 1, color);
+    return;
+  }
+
+  if (x0 == x1)
+  {
+    if (y0 > y1)
+      swapInt16(y0, y1);
+    if (x0 < 0 || x0 >= WIDTH || y1 < 0 || y0 >= HEIGHT)
+      return;
+    if (y0 < 0)
+      y0 = 0;
+    if (y1 >= HEIGHT)
+      y1 = HEIGHT - 1;
+    drawFastVLine(x0, y0, y1 - y0 + 1, color);
+    return;
+  }
+
   // bresenham's algorithm - thx wikpedia
   bool steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
@@ -504,35 +706,141 @@ void Arduboy2Base::drawLine
   dy = abs(y1 - y0);
 
   int16_t err = dx / 2;
-  int8_t ystep;
+  int8_t ystep = (y0 < y1) ? 1 : -1;
+
+  // From here, x is the major axis, which steps once per point, and y is
+  // the minor axis. These are the screen limits for each.
+  int16_t xMax = steep ? HEIGHT - 1 : WIDTH - 1;
+  int16_t yMax = steep ? WIDTH - 1 : HEIGHT - 1;
+  int16_t yLow = (ystep > 0) ? y0 : y1;
+  int16_t yHigh = (ystep > 0) ? y1 : y0;
+
+  if (x1 < 0 || x0 > xMax || yHigh < 0 || yLow > yMax)
+    return;
+
+  uint16_t count = dx + 1;
+
+  if (x0 < 0 || x1 > xMax || yLow < 0 || yHigh > yMax)
+  {
+    // Find the first and last points on the screen, with the same points
+    // in between as the whole line would have, without stepping through
+    // the points off the screen.
+    // After n points, y has moved ceil((n * dy - err) / dx) times.
+    int16_t yStart = (ystep > 0) ? -y0 : y0 - yMax; // steps to the screen
+    int16_t yLimit = (ystep > 0) ? yMax - y0 : y0;  // steps to leave it
+    int32_t nStart = (x0 < 0) ? -x0 : 0;
+    int32_t nEnd = (x1 > xMax) ? xMax - x0 : dx;
+
+    if (yStart > 0)
+    {
+      int32_t n = (((int32_t)(yStart - 1) * dx + err) / dy) + 1;
+      if (n > nStart)
+        nStart = n;
+    }
+    if (yLimit < dy)
+    {
+      int32_t n = ((int32_t)yLimit * dx + err) / dy;
+      if (n < nEnd)
+        nEnd = n;
+    }
+    if (nStart > nEnd)
+      return;
+
+    int32_t t = (nStart * dy) - err;
+    int16_t k = (t > 0) ? (t + dx - 1) / dx : 0;
+
+    x0 += nStart;
+    y0 += (ystep > 0) ? k : -k;
+    err += (k * (int32_t)dx) - (nStart * dy);
+    count = nEnd - nStart + 1;
+  }
+
+  // step a buffer pointer and pixel mask, instead of finding the location
+  // of each point
+  uint8_t *pBuf;
+  uint8_t mask;
+  int16_t xLast = x0 + count - 1;
+  int16_t yFirst = y0;
 
-  if (y0 < y1)
+  if (steep)
   {
-    ystep = 1;
+    pBuf = sBuffer + ((x0 / 8) * WIDTH) + y0;
+    mask = _BV(x0 & 7);
   }
   else
   {
-    ystep = -1;
+    pBuf = sBuffer + ((y0 / 8) * WIDTH) + x0;
+    mask = _BV(y0 & 7);
   }
 
-  for (; x0 <= x1; x0++)
+  while (true)
   {
-    if (steep)
-    {
-      drawPixel(y0, x0, color);
-    }
+    if (color == WHITE)
+      *pBuf |= mask;
+    else if (color == BLACK)
+      *pBuf &= ~mask;
     else
-    {
-      drawPixel(x0, y0, color);
-    }
+      *pBuf ^= mask;
+
+    if (--count == 0)
+      break;
 
     err -= dy;
-    if (err < 0)
+    bool yStep = err < 0;
+    if (yStep)
     {
       y0 += ystep;
       err += dx;
     }
+
+    if (steep)
+    {
+      // x is down the screen and y is across it
+      mask <<= 1;
+      if (mask == 0)
+      {
+        mask = 0x01;
+        pBuf += WIDTH;
+      }
+      if (yStep)
+        pBuf += ystep;
+    }
+    else
+    {
+      // x is across the screen and y is down it
+      pBuf++;
+      if (yStep)
+      {
+        if (ystep > 0)
+        {
+          mask <<= 1;
+          if (mask == 0)
+          {
+            mask = 0x01;
+            pBuf += WIDTH;
+          }
+        }
+        else
+        {
+          mask >>= 1;
+          if (mask == 0)
+          {
+            mask = 0x80;
+            pBuf -= WIDTH;
+          }
+        }
+      }
+    }
   }
+
+  // mark the area of the points that were drawn
+  int16_t yFrom = (ystep > 0) ? yFirst : y0;
+  int16_t yTo = (ystep > 0) ? y0 : yFirst;
+
+  if (steep)
+    expandDirty(yFrom, yTo, x0 / 8, xLast / 8);
+  else
+    expandDirty(x0, xLast, yFrom / 8, yTo / 8);
 }
 
 void Arduboy2Base::drawRect
@@ -547,11 +855,7 @@ void Arduboy2Base::drawRect
 void Arduboy2Base::drawFastVLine
 (int16_t x, int16_t y, uint8_t h, uint8_t color)
 {
-  int end = y+h;
-  for (int a = max(0,y); a < min(end,HEIGHT); a++)
-  {
-    drawPixel(x,a,color);
-  }
+  fillRect(x, y, 1, h, color);
 }
 
 void Arduboy2Base::drawFastHLine
@@ -566,7 +870,7 @@ void Arduboy2Base::drawFastHLine
   xEnd = x + w;
 
   // Check if the entire line is not on the display
-  if (xEnd <= 0 || x >= WIDTH)
+  if (w == 0 || xEnd <= 0 || x >= WIDTH)
     return;
 
   // Don't start before the left edge
@@ -580,38 +884,158 @@ void Arduboy2Base::drawFastHLine
   // calculate actual width (even if unchanged)
   w = xEnd - x;
 
+  expandDirty(x, xEnd - 1, y / 8, y / 8);
+
   // buffer pointer plus row offset + x offset
   uint8_t *pBuf = sBuffer + ((y / 8) * WIDTH) + x;
 
   // pixel mask
   uint8_t mask = 1 << (y & 7);
 
+  // Each byte is changed using: *pBuf = (*pBuf & andMask) ^ xorMask
+  // which allows the same loop to be used for all colors.
+  uint8_t andMask;
+  uint8_t xorMask;
+
   switch (color)
   {
     case WHITE:
-      while (w--)
-      {
-        *pBuf++ |= mask;
-      }
+      andMask = ~mask;
+      xorMask = mask;
       break;
 
     case BLACK:
-      mask = ~mask;
-      while (w--)
-      {
-        *pBuf++ &= mask;
-      }
+      andMask = ~mask;
+      xorMask = 0;
       break;
+
+    case INVERT:
+      andMask = 0xFF;
+      xorMask = mask;
+      break;
+
+    default:
+      return;
   }
+
+  // C version:
+  //
+  // while (w--)
+  // {
+  //   *pBuf = (*pBuf & andMask) ^ xorMask;
+  //   pBuf++;
+  // }
+
+  // The asm version is unrolled to do two bytes per loop iteration.
+  // w is at least 1 here, because a w of 0 returns early in the bounds
+  // check above and clipping always leaves at least 1 pixel on the display.
+  asm volatile
+  (
+    // if the width is odd, do one byte before the loop
+    "sbrs %[count], 0                  \n"
+    "rjmp 1f                           \n"
+    "ld   __tmp_reg__, %a[ptr]         \n"
+    "and  __tmp_reg__, %[andMask]      \n"
+    "eor  __tmp_reg__, %[xorMask]      \n"
+    "st   %a[ptr]+, __tmp_reg__        \n"
+    "1:                                \n"
+    // count = number of byte pairs. Skip the loop if none
+    "lsr  %[count]                     \n"
+    "breq 3f                           \n"
+    "2:                                \n"
+    "ld   __tmp_reg__, %a[ptr]         \n"
+    "and  __tmp_reg__, %[andMask]      \n"
+    "eor  __tmp_reg__, %[xorMask]      \n"
+    "st   %a[ptr]+, __tmp_reg__        \n"
+    "ld   __tmp_reg__, %a[ptr]         \n"
+    "and  __tmp_reg__, %[andMask]      \n"
+    "eor  __tmp_reg__, %[xorMask]      \n"
+    "st   %a[ptr]+, __tmp_reg__        \n"
+    "dec  %[count]                     \n"
+    "brne 2b                           \n"
+    "3:                                \n"
+    : [ptr]     "+e" (pBuf),
+      [count]   "+r" (w)
+    : [andMask] "r"  (andMask),
+      [xorMask] "r"  (xorMask)
+    : "memory"
+  );
 }
 
 void Arduboy2Base::fillRect
 (int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color)
 {
-  // stupidest version - update in subclasses if desired!
-  for (int16_t i=x; i<x+w; i++)
+  int16_t xEnd = x + w; // last x point + 1
+  int16_t yEnd = y + h; // last y point + 1
+
+  // Check if the entire rectangle is not on the display
+  if (w == 0 || h == 0 || xEnd <= 0 || x >= WIDTH || yEnd <= 0 || y >= HEIGHT)
+    return;
+
+  // Clip to the edges of the display
+  if (x < 0)
+    x = 0;
+  if (xEnd > WIDTH)
+    xEnd = WIDTH;
+  if (y < 0)
+    y = 0;
+  if (yEnd > HEIGHT)
+    yEnd = HEIGHT;
+
+  expandDirty(x, xEnd - 1, y / 8, (yEnd - 1) / 8);
+  fillRectUnclipped(x, y, xEnd - x, yEnd - y, color);
+}
+
+// fill a rectangle that's entirely on the screen, without marking it dirty
+void Arduboy2Base::fillRectUnclipped
+(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+  uint8_t page = y / 8;
+  uint8_t lastPage = (y + h - 1) / 8;
+
+  // pixel masks for the partially covered top and bottom bytes.
+  // All the pages in between are fully covered.
+  uint8_t mask = 0xFF << (y & 7);
+  uint8_t lastMask = 0xFF >> (7 - ((y + h - 1) & 7));
+
+  // buffer pointer plus row offset + x offset
+  uint8_t *pRow = sBuffer + (page * WIDTH) + x;
+
+  while (true)
   {
-    drawFastVLine(i, y, h, color);
+    if (page == lastPage)
+      mask &= lastMask;
+
+    uint8_t *pBuf = pRow;
+    uint8_t count = w;
+
+    switch (color)
+    {
+      case WHITE:
+        do {
+          *pBuf++ |= mask;
+        } while (--count);
+        break;
+
+      case BLACK:
+        do {
+          *pBuf++ &= ~mask;
+        } while (--count);
+        break;
+
+      case INVERT:
+        do {
+          *pBuf++ ^= mask;
+        } while (--count);
+        break;
+    }
+
+    if (page == lastPage)
+      break;
+
+    page++;
+    pRow += WIDTH;
+    mask = 0xFF;
   }
 }
 
@@ -637,6 +1061,8 @@ void Arduboy2Base::fillScreen(uint8_t color)
   // which can be declared a read-write operand
   uint8_t* bPtr = sBuffer;
 
+  expandDirty(0, WIDTH - 1, 0, (HEIGHT / 8) - 1);
+
   asm volatile
   (
     // if value is zero, skip assigning to 0xff
@@ -808,40 +1234,58 @@ void Arduboy2Base::drawBitmap
   if (x + w <= 0 || x > WIDTH - 1 || y + h <= 0 || y > HEIGHT - 1)
     return;
 
-  int yOffset = abs(y) % 8;
-  int sRow = y / 8;
-  if (y < 0) {
-    sRow--;
-    yOffset = 8 - yOffset;
-  }
-  int rows = h/8;
-  if (h%8!=0) rows++;
-  for (int a = 0; a < rows; a++) {
-    int bRow = sRow + a;
-    if (bRow > (HEIGHT/8)-1) break;
-    if (bRow > -2) {
-      for (int iCol = 0; iCol<w; iCol++) {
-        if (iCol + x > (WIDTH-1)) break;
-        if (iCol + x >= 0) {
-          if (bRow >= 0) {
-            if (color == WHITE)
-              sBuffer[(bRow*WIDTH) + x + iCol] |= pgm_read_byte(bitmap+(a*w)+iCol) << yOffset;
-            else if (color == BLACK)
-              sBuffer[(bRow*WIDTH) + x + iCol] &= ~(pgm_read_byte(bitmap+(a*w)+iCol) << yOffset);
-            else
-              sBuffer[(bRow*WIDTH) + x + iCol] ^= pgm_read_byte(bitmap+(a*w)+iCol) << yOffset;
-          }
-          if (yOffset && bRow<(HEIGHT/8)-1 && bRow > -2) {
-            if (color == WHITE)
-              sBuffer[((bRow+1)*WIDTH) + x + iCol] |= pgm_read_byte(bitmap+(a*w)+iCol) >> (8-yOffset);
-            else if (color == BLACK)
-              sBuffer[((bRow+1)*WIDTH) + x + iCol] &= ~(pgm_read_byte(bitmap+(a*w)+iCol) >> (8-yOffset));
-            else
-              sBuffer[((bRow+1)*WIDTH) + x + iCol] ^= pgm_read_byte(bitmap+(a*w)+iCol) >> (8-yOffset);
-          }
-        }
-      }
+  uint8_t rows = (h + 7) / 8;
+  markDirty(x, y, w, rows * 8);
+
+  // the buffer row that each row of the bitmap starts in, and how far down
+  // it's shifted from the top of that row
+  int8_t sRow = y >> 3;
+  uint8_t yOffset = y & 7;
+  uint8_t mul_amt = 1 << yOffset;
+
+  // skip the columns and rows of the bitmap that are off the screen
+  uint8_t xOffset = (x < 0) ? -x : 0;
+  uint8_t renderedWidth = ((x + w > WIDTH) ? WIDTH - x : w) - xOffset;
+  uint8_t startRow = (sRow < -1) ? -1 - sRow : 0;
+
+  if (sRow + rows > (HEIGHT / 8))
+    rows = (HEIGHT / 8) - sRow;
+  rows -= startRow;
+  sRow += startRow;
+
+  const uint8_t *bofs = bitmap + (startRow * w) + xOffset;
+  int16_t ofs = (sRow * WIDTH) + x + xOffset;
+
+  // Each byte is changed using: *pBuf = (*pBuf & ~(data & andSel)) ^
+  // (data & xorSel), which allows the same loop to be used for all colors.
+  uint8_t andSel = (color == WHITE || color == BLACK) ? 0xFF : 0x00;
+  uint8_t xorSel = (color == BLACK) ? 0x00 : 0xFF;
+
+  for (uint8_t a = 0; a < rows; a++)
+  {
+    // a bitmap row can straddle the top or bottom of the screen
+    bool drawUpper = sRow >= 0;
+    bool drawLower = yOffset != 0 && sRow < (HEIGHT / 8) - 1;
+    uint8_t *pBuf = sBuffer + ofs;
+    const uint8_t *pBitmap = bofs;
+
+    for (uint8_t iCol = renderedWidth; iCol != 0; iCol--)
+    {
+      // one read gives the bytes for both buffer rows
+      uint16_t data = pgm_read_byte(pBitmap++) * mul_amt;
+      uint8_t upper = data;
+      uint8_t lower = data >> 8;
+
+      if (drawUpper)
+        *pBuf = (*pBuf & ~(upper & andSel)) ^ (upper & xorSel);
+      if (drawLower)
+        pBuf[WIDTH] = (pBuf[WIDTH] & ~(lower & andSel)) ^ (lower & xorSel);
+      pBuf++;
     }
+
+    sRow++;
+    bofs += w;
+    ofs += WIDTH;
   }
 }
 
@@ -853,6 +1297,8 @@ void Arduboy2Base::drawSlowXYBitmap
   if (x + w <= 0 || x > WIDTH - 1 || y + h <= 0 || y > HEIGHT - 1)
     return;
 
+  markDirty(x, y, w, h);
+
   int16_t xi, yi, byteWidth = (w + 7) / 8;
   for(yi = 0; yi < h; yi++) {
     for(xi = 0; xi < w; xi++ ) {
@@ -868,32 +1314,55 @@ class Arduboy2Base::BitStreamReader
 {
  private:
   const uint8_t *source;
-  uint16_t sourceIndex;
-  uint8_t bitBuffer;
-  uint8_t byteBuffer;
+  uint8_t byteBuffer; // the unread bits of the current byte, next in bit 0
+  uint8_t bitsLeft;   // the number of unread bits in byteBuffer
 
  public:
   BitStreamReader(const uint8_t *bitmap)
-    : source(bitmap), sourceIndex(), bitBuffer(), byteBuffer()
+    : source(bitmap), byteBuffer(), bitsLeft()
+  {
+  }
+
+  uint8_t readBit()
   {
+    if (bitsLeft == 0)
+    {
+      byteBuffer = pgm_read_byte(source++);
+      bitsLeft = 8;
+    }
+
+    uint8_t bit = byteBuffer & 0x01;
+    byteBuffer >>= 1;
+    --bitsLeft;
+    return bit;
   }
 
-  uint16_t readBits(uint16_t bitCount)
+  // Read a value, least significant bit first, taking as many bits at a time
+  // as are available in the current byte. Only the lower 16 bits are kept.
+  // (The upper bits of a span length are always zero.)
+  uint16_t readBits(uint8_t bitCount)
   {
     uint16_t result = 0;
-    for (uint16_t i = 0; i < bitCount; i++)
+    uint8_t shift = 0;
+
+    while (bitCount != 0)
     {
-      if (bitBuffer == 0)
+      if (bitsLeft == 0)
       {
-        bitBuffer = 0x1;
-        byteBuffer = pgm_read_byte(&source[sourceIndex]);
-        ++sourceIndex;
+        byteBuffer = pgm_read_byte(source++);
+        bitsLeft = 8;
       }
 
-      if ((byteBuffer & bitBuffer) != 0)
-        result |= (1 << i);
+      uint8_t count = (bitCount < bitsLeft) ? bitCount : bitsLeft;
+      uint8_t bits = byteBuffer & (uint8_t)(0xFF >> (8 - count));
+
+      if (shift < 16)
+        result |= (uint16_t)bits << shift;
 
-      bitBuffer <<= 1;
+      byteBuffer >>= count;
+      bitsLeft -= count;
+      bitCount -= count;
+      shift += count;
     }
     return result;
   }
@@ -907,13 +1376,12 @@ void Arduboy2Base::drawCompressed(int16_t sx, int16_t sy, const uint8_t *bitmap,
   // read header
   int width = (int)cs.readBits(8) + 1;
   int height = (int)cs.readBits(8) + 1;
-  uint8_t spanColour = (uint8_t)cs.readBits(1); // starting colour
+  uint8_t spanColour = cs.readBit(); // starting colour
 
   // no need to draw at all if we're offscreen
   if ((sx + width <= 0) || (sx > WIDTH - 1) || (sy + height <= 0) || (sy > HEIGHT - 1))
     return;
 
-  // sy = sy - (frame * height);
   int yOffset = abs(sy) % 8;
   int startRow = sy / 8;
   if (sy < 0) {
@@ -923,85 +1391,187 @@ void Arduboy2Base::drawCompressed(int16_t sx, int16_t sy, const uint8_t *bitmap,
   int rows = height / 8;
   if ((height % 8) != 0)
     ++rows;
+  markDirty(sx, sy, width, rows * 8);
 
-  int rowOffset = 0; // +(frame*rows);
+  int rowOffset = 0;
   int columnOffset = 0;
 
-  uint8_t byte = 0x00;
-  uint8_t bit = 0x01;
-  while (rowOffset < rows) // + (frame*rows))
-  {
-    uint16_t bitLength = 1;
-    while (cs.readBits(1) == 0)
-      bitLength += 2;
-
-    uint16_t len = cs.readBits(bitLength) + 1; // span length
+  // the colour is toggled as each span is read, including the first one
+  spanColour ^= 0x01;
+  uint16_t spanLeft = 0; // pixels of the current span not yet used
 
-    // draw the span
-    for (uint16_t i = 0; i < len; ++i)
+  while (rowOffset < rows)
+  {
+    // whole bytes of an unset span don't change the buffer, so skip them
+    if ((spanColour == 0) && (spanLeft >= 8))
     {
-      if (spanColour != 0)
-        byte |= bit;
-      bit <<= 1;
+      columnOffset += spanLeft / 8;
+      spanLeft &= 0x07;
+      while (columnOffset >= width)
+      {
+        columnOffset -= width;
+        ++rowOffset;
+      }
+      continue;
+    }
 
-      if (bit == 0) // reached end of byte
+    // build the next byte of the image from as many spans as it takes
+    uint8_t byte = 0x00;
+    uint8_t bitPos = 0;
+    do
+    {
+      if (spanLeft == 0)
       {
-        // draw
-        int bRow = startRow + rowOffset;
+        spanColour ^= 0x01; // toggle colour bit (bit 0) for the new span
 
-        //if (byte) // possible optimisation
-        if ((bRow <= (HEIGHT / 8) - 1) && (bRow > -2) &&
-            (columnOffset + sx <= (WIDTH - 1)) && (columnOffset + sx >= 0))
-        {
-          int16_t offset = (bRow * WIDTH) + sx + columnOffset;
-          if (bRow >= 0)
-          {
-            int16_t index = offset;
-            uint8_t value = byte << yOffset;
+        uint8_t bitLength = 1;
+        while (cs.readBit() == 0)
+          bitLength += 2;
 
-            if (color != 0)
-              sBuffer[index] |= value;
-            else
-              sBuffer[index] &= ~value;
-          }
-          if ((yOffset != 0) && (bRow < (HEIGHT / 8) - 1))
-          {
-            int16_t index = offset + WIDTH;
-            uint8_t value = byte >> (8 - yOffset);
+        spanLeft = cs.readBits(bitLength) + 1; // span length
+      }
 
-            if (color != 0)
-              sBuffer[index] |= value;
-            else
-              sBuffer[index] &= ~value;
-          }
-        }
+      // fill as much of the byte as possible from the current span
+      uint8_t count = 8 - bitPos;
+      if (spanLeft < count)
+        count = spanLeft;
 
-        // iterate
-        ++columnOffset;
-        if (columnOffset >= width)
-        {
-          columnOffset = 0;
-          ++rowOffset;
-        }
+      if (spanColour != 0)
+        byte |= (uint8_t)(0xFF >> (8 - count)) << bitPos;
+
+      bitPos += count;
+      spanLeft -= count;
+    } while (bitPos < 8);
+
+    // draw
+    int bRow = startRow + rowOffset;
+
+    if ((byte != 0) &&
+        (bRow <= (HEIGHT / 8) - 1) && (bRow > -2) &&
+        (columnOffset + sx <= (WIDTH - 1)) && (columnOffset + sx >= 0))
+    {
+      int16_t offset = (bRow * WIDTH) + sx + columnOffset;
+      if (bRow >= 0)
+      {
+        int16_t index = offset;
+        uint8_t value = byte << yOffset;
 
-        // reset byte
-        byte = 0x00;
-        bit = 0x01;
+        if (color != 0)
+          sBuffer[index] |= value;
+        else
+          sBuffer[index] &= ~value;
+      }
+      if ((yOffset != 0) && (bRow < (HEIGHT / 8) - 1))
+      {
+        int16_t index = offset + WIDTH;
+        uint8_t value = byte >> (8 - yOffset);
+
+        if (color != 0)
+          sBuffer[index] |= value;
+        else
+          sBuffer[index] &= ~value;
       }
     }
 
-    spanColour ^= 0x01; // toggle colour bit (bit 0) for next span
+    // iterate
+    ++columnOffset;
+    if (columnOffset >= width)
+    {
+      columnOffset = 0;
+      ++rowOffset;
+    }
   }
 }
 
 void Arduboy2Base::display()
 {
   paintScreen(sBuffer);
+  resetDirty();
+  sendViewStart();
 }
 
 void Arduboy2Base::display(bool clear)
 {
   paintScreen(sBuffer, clear);
+  if (clear) {
+    // the cleared buffer now differs from the display everywhere
+    expandDirty(0, WIDTH - 1, 0, (HEIGHT / 8) - 1);
+  }
+  else {
+    resetDirty();
+  }
+  sendViewStart();
+}
+
+// Send a start line set by scrollViewVertical() or resetView() to the
+// display. This is done after the buffer has been sent, so that the
+// display never shows the new start line with the old buffer contents.
+void Arduboy2Base::sendViewStart()
+{
+  if (viewStartChanged) {
+    setDisplayStartLine(viewStart);
+    viewStartChanged = false;
+  }
+}
+
+void Arduboy2Base::scrollViewVertical(int8_t dy)
+{
+  uint8_t rows;
+  uint8_t first; // the first buffer row to be cleared
+
+  if (dy >= 0) {
+    rows = dy;
+    first = viewStart;
+  }
+  else {
+    rows = -dy;
+    first = viewStart + dy;
+  }
+  viewStart = (viewStart + dy) & (HEIGHT - 1);
+  first &= HEIGHT - 1;
+
+  if (rows > HEIGHT) {
+    rows = HEIGHT;
+  }
+
+  // the rows to clear may wrap around from the bottom of the buffer to the
+  // top, so also clear them shifted up by the height of the buffer
+  fillRect(0, first, WIDTH, rows, BLACK);
+  fillRect(0, first - HEIGHT, WIDTH, rows, BLACK);
+
+  viewStartChanged = true;
+}
+
+void Arduboy2Base::scrollViewHorizontal(int8_t dx)
+{
+  uint8_t cols;
+  uint8_t* clearStart;
+
+  if (dx >= 0) {
+    cols = dx;
+    // move everything left, as one block. The columns moved from the start
+    // of one page to the end of the previous one are then cleared.
+    memmove(sBuffer, sBuffer + cols, sizeof(sBuffer) - cols);
+    clearStart = sBuffer + WIDTH - cols;
+  }
+  else {
+    cols = -dx;
+    memmove(sBuffer + cols, sBuffer, sizeof(sBuffer) - cols);
+    clearStart = sBuffer;
+  }
+
+  for (uint8_t page = 0; page < (HEIGHT / 8); page++) {
+    memset(clearStart, 0, cols);
+    clearStart += WIDTH;
+  }
+
+  expandDirty(0, WIDTH - 1, 0, (HEIGHT / 8) - 1);
+}
+
+void Arduboy2Base::resetView()
+{
+  viewStart = 0;
+  viewStartChanged = true;
 }
 
 uint8_t* Arduboy2Base::getBuffer()
@@ -1054,16 +1624,120 @@ bool Arduboy2Base::collide(Rect rect1, Rect rect2)
            rect2.y + rect2.height <= rect1.y);
 }
 
+// Get 8 vertical pixels of a sprite frame, starting at the given row.
+// Pixels below the bottom of the frame are undefined.
+static uint8_t spriteColumn(const uint8_t *frame, uint8_t width, uint8_t pages,
+                            uint8_t column, uint8_t row)
+{
+  uint8_t page = row / 8;
+  uint8_t shift = row & 7;
+  const uint8_t *p = frame + (page * width) + column;
+  uint8_t bits = pgm_read_byte(p) >> shift;
+
+  if (shift != 0 && page + 1 < pages) {
+    bits |= pgm_read_byte(p + width) << (8 - shift);
+  }
+  return bits;
+}
+
+bool Arduboy2Base::collide(int16_t x1, int16_t y1,
+                           const uint8_t *bitmap1, uint8_t frame1,
+                           int16_t x2, int16_t y2,
+                           const uint8_t *bitmap2, uint8_t frame2)
+{
+  uint8_t w1 = pgm_read_byte(bitmap1);
+  uint8_t h1 = pgm_read_byte(bitmap1 + 1);
+  uint8_t w2 = pgm_read_byte(bitmap2);
+  uint8_t h2 = pgm_read_byte(bitmap2 + 1);
+
+  // find the area where the bitmaps overlap
+  int16_t left = max(x1, x2);
+  int16_t right = min(x1 + w1, x2 + w2);
+  int16_t top = max(y1, y2);
+  int16_t bottom = min(y1 + h1, y2 + h2);
+
+  if (left >= right || top >= bottom) {
+    return false;
+  }
+
+  uint8_t pages1 = (h1 + 7) / 8;
+  uint8_t pages2 = (h2 + 7) / 8;
+  const uint8_t *data1 = bitmap1 + 2 + (frame1 * (uint16_t)(w1 * pages1));
+  const uint8_t *data2 = bitmap2 + 2 + (frame2 * (uint16_t)(w2 * pages2));
+
+  for (int16_t x = left; x < right; x++) {
+    for (int16_t y = top; y < bottom; y += 8) {
+      uint8_t bits = spriteColumn(data1, w1, pages1, x - x1, y - y1) &
+                     spriteColumn(data2, w2, pages2, x - x2, y - y2);
+
+      // ignore any pixels past the bottom of the overlap
+      if (bottom - y < 8) {
+        bits &= 0xFF >> (8 - (bottom - y));
+      }
+      if (bits != 0) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+uint8_t Arduboy2Base::readSysEEPROM(uint16_t address)
+{
+  if (!sysEEPROMLoaded) {
+    for (uint8_t i = 0; i < EEPROM_STORAGE_SPACE_START; i++) {
+      sysEEPROM[i] = EEPROM.read(i);
+    }
+    sysEEPROMLoaded = true;
+  }
+  return sysEEPROM[address];
+}
+
+void Arduboy2Base::writeSysEEPROM(uint16_t address, uint8_t value)
+{
+  if (readSysEEPROM(address) != value) {
+    sysEEPROM[address] = value;
+    if (sysEEPROMDeferred) {
+      sysEEPROMChanged |= (uint16_t)1 << address;
+    }
+    else {
+      EEPROM.update(address, value);
+    }
+  }
+}
+
+void Arduboy2Base::beginSystemEEPROMUpdate()
+{
+  sysEEPROMDeferred = true;
+}
+
+void Arduboy2Base::commitSystemEEPROM()
+{
+  for (uint8_t i = 0; sysEEPROMChanged != 0; i++, sysEEPROMChanged >>= 1) {
+    if (sysEEPROMChanged & 1) {
+      EEPROM.update(i, sysEEPROM[i]);
+    }
+  }
+  sysEEPROMDeferred = false;
+}
+
+void Arduboy2Base::discardSystemEEPROMChanges()
+{
+  sysEEPROMLoaded = false;
+  sysEEPROMChanged = 0;
+  sysEEPROMDeferred = false;
+}
+
 uint16_t Arduboy2Base::readUnitID()
 {
-  return EEPROM.read(eepromUnitID) |
-         (((uint16_t)(EEPROM.read(eepromUnitID + 1))) << 8);
+  return readSysEEPROM(eepromUnitID) |
+         (((uint16_t)(readSysEEPROM(eepromUnitID + 1))) << 8);
 }
 
 void Arduboy2Base::writeUnitID(uint16_t id)
 {
-  EEPROM.update(eepromUnitID, (uint8_t)(id & 0xff));
-  EEPROM.update(eepromUnitID + 1, (uint8_t)(id >> 8));
+  writeSysEEPROM(eepromUnitID, (uint8_t)(id & 0xff));
+  writeSysEEPROM(eepromUnitID + 1, (uint8_t)(id >> 8));
 }
 
 uint8_t Arduboy2Base::readUnitName(char* name)
@@ -1074,7 +1748,7 @@ uint8_t Arduboy2Base::readUnitName(char* name)
 
   for (dest = 0; dest < ARDUBOY_UNIT_NAME_LEN; dest++)
   {
-    val = EEPROM.read(src);
+    val = readSysEEPROM(src);
     name[dest] = val;
     src++;
     if (val == 0x00 || (byte)val == 0xFF) {
@@ -1097,48 +1771,63 @@ void Arduboy2Base::writeUnitName(const char* name)
       done = true;
     }
     // write character or 0 pad if finished
-    EEPROM.update(dest, done ? 0x00 : name[src]);
+    writeSysEEPROM(dest, done ? 0x00 : name[src]);
     dest++;
   }
 }
 
 bool Arduboy2Base::readShowBootLogoFlag()
 {
-  return (EEPROM.read(eepromSysFlags) & sysFlagShowLogoMask);
+  return (readSysEEPROM(eepromSysFlags) & sysFlagShowLogoMask);
 }
 
 void Arduboy2Base::writeShowBootLogoFlag(bool val)
 {
-  uint8_t flags = EEPROM.read(eepromSysFlags);
+  uint8_t flags = readSysEEPROM(eepromSysFlags);
 
   bitWrite(flags, sysFlagShowLogoBit, val);
-  EEPROM.update(eepromSysFlags, flags);
+  writeSysEEPROM(eepromSysFlags, flags);
 }
 
 bool Arduboy2Base::readShowUnitNameFlag()
 {
-  return (EEPROM.read(eepromSysFlags) & sysFlagUnameMask);
+  return (readSysEEPROM(eepromSysFlags) & sysFlagUnameMask);
 }
 
 void Arduboy2Base::writeShowUnitNameFlag(bool val)
 {
-  uint8_t flags = EEPROM.read(eepromSysFlags);
+  uint8_t flags = readSysEEPROM(eepromSysFlags);
 
   bitWrite(flags, sysFlagUnameBit, val);
-  EEPROM.update(eepromSysFlags, flags);
+  writeSysEEPROM(eepromSysFlags, flags);
 }
 
 bool Arduboy2Base::readShowBootLogoLEDsFlag()
 {
-  return (EEPROM.read(eepromSysFlags) & sysFlagShowLogoLEDsMask);
+  return (readSysEEPROM(eepromSysFlags) & sysFlagShowLogoLEDsMask);
 }
 
 void Arduboy2Base::writeShowBootLogoLEDsFlag(bool val)
 {
-  uint8_t flags = EEPROM.read(eepromSysFlags);
+  uint8_t flags = readSysEEPROM(eepromSysFlags);
 
   bitWrite(flags, sysFlagShowLogoLEDsBit, val);
-  EEPROM.update(eepromSysFlags, flags);
+  writeSysEEPROM(eepromSysFlags, flags);
+}
+
+bool Arduboy2Base::readQuickBootLogoFlag()
+{
+  // the flag is stored inverted, so that erased EEPROM gives the full
+  // sequence
+  return !(readSysEEPROM(eepromSysFlags) & sysFlagFullLogoMask);
+}
+
+void Arduboy2Base::writeQuickBootLogoFlag(bool val)
+{
+  uint8_t flags = readSysEEPROM(eepromSysFlags);
+
+  bitWrite(flags, sysFlagFullLogoBit, !val);
+  writeSysEEPROM(eepromSysFlags, flags);
 }
 
 void Arduboy2Base::swapInt16(int16_t& a, int16_t& b)
@@ -1182,6 +1871,8 @@ void Arduboy2::begin()
 //  bootLogoSpritesBOverwrite();
 
   waitNoButtons();
+
+  nextStepTime = millis(); // nextFrameSteps() timing starts now
 }
 
 void Arduboy2::bootLogo()
@@ -1237,6 +1928,7 @@ void Arduboy2::bootLogoSpritesBOverwrite()
 void Arduboy2::bootLogoText()
 {
   bool showLEDs = readShowBootLogoLEDsFlag();
+  bool quick = readQuickBootLogoFlag();
 
   if (!readShowBootLogoFlag()) {
     return;
@@ -1246,8 +1938,10 @@ void Arduboy2::bootLogoText()
     digitalWriteRGB(RED_LED, RGB_ON);
   }
 
-  for (int16_t y = -15; y <= 24; y++) {
-    if (pressed(RIGHT_BUTTON)) {
+  // a quick sequence starts one pixel higher so it still ends at 24
+  for (int16_t y = quick ? -16 : -15; y <= 24;
+       y += quick ? quickLogoStep : 1) {
+    if (anyPressed(quick ? quickLogoAbortButtons : RIGHT_BUTTON)) {
       digitalWriteRGB(RGB_OFF, RGB_OFF, RGB_OFF); // all LEDs off
       return;
     }
@@ -1273,7 +1967,7 @@ void Arduboy2::bootLogoText()
     digitalWriteRGB(GREEN_LED, RGB_OFF);  // green LED off
     digitalWriteRGB(BLUE_LED, RGB_ON);    // blue LED on
   }
-  delayShort(400);
+  delayShort(quick ? quickLogoHold : 400);
   digitalWriteRGB(BLUE_LED, RGB_OFF);
 
   bootLogoExtra();
@@ -1288,7 +1982,7 @@ void Arduboy2::bootLogoExtra()
     return;
   }
 
-  c = EEPROM.read(eepromUnitName);
+  c = readSysEEPROM(eepromUnitName);
 
   if (c != 0xFF && c != 0x00)
   {
@@ -1299,12 +1993,12 @@ void Arduboy2::bootLogoExtra()
     do
     {
       write(c);
-      c = EEPROM.read(++i);
+      c = readSysEEPROM(++i);
     }
     while (i < eepromUnitName + ARDUBOY_UNIT_NAME_LEN);
 
     display();
-    delayShort(1000);
+    delayShort(readQuickBootLogoFlag() ? quickUnitNameHold : 1000);
   }
 }
 
@@ -1334,86 +2028,129 @@ size_t Arduboy2::write(uint8_t c)
 void Arduboy2::drawChar
   (int16_t x, int16_t y, uint8_t c, uint8_t color, uint8_t bg, uint8_t size)
 {
-// It is assumed that rendering characters fully off screen will be rare,
-// so let drawPixel() handle off screen checks, to reduce code size at the
-// expense of slower off screen character handling.
-#if 0
   if ((x >= WIDTH) ||              // Clip right
       (y >= HEIGHT) ||             // Clip bottom
-      ((x + characterWidth * size - 1) < 0) ||  // Clip left
-      ((y + characterHeight * size - 1) < 0)    // Clip top
+      ((x + fullCharacterWidth * size - 1) < 0) ||  // Clip left
+      ((y + fullCharacterHeight * size - 1) < 0)    // Clip top
      )
   {
     return;
   }
-#endif
 
   bool drawBackground = bg != color;
   const uint8_t* bitmap =
     &font5x7[c * characterWidth * ((characterHeight + 8 - 1) / 8)];
 
-  for (uint8_t i = 0; i < fullCharacterWidth; i++)
-  {
-    uint8_t column;
+  // This function assumes that each font column is a single byte and that
+  // the character spacing below it fits in the same byte.
+  constexpr uint8_t cellMask = 0xFF >> (8 - fullCharacterHeight);
 
-    if (characterHeight <= 8)
-    {
-      column = (i < characterWidth) ? pgm_read_byte(bitmap++) : 0;
-    }
-    else
+  if (size > 1)
+  {
+    // draw each vertical run of foreground or background pixels in a
+    // column as a single filled rectangle
+    for (uint8_t i = 0; i < fullCharacterWidth; i++)
     {
-      column = 0;
-    }
+      uint8_t column = (i < characterWidth) ? pgm_read_byte(bitmap++) : 0;
+      uint8_t j = 0;
 
-    // draw the character by columns. Top to bottom, left to right
-    // including character spacing on the right
-    for (uint8_t j = 0; j < characterHeight; j++)
-    {
-      if (characterHeight > 8)
+      while (j < fullCharacterHeight)
       {
-        // at this point variable "column" will be 0, either from initialization
-        // or by having eight 0 bits shifted in by the >>= operation below
-        if ((j % 8 == 0) && (i < characterWidth))
+        // pixelIsSet should be a bool but at the time of writing,
+        // the GCC AVR compiler generates less code if it's a uint8_t
+        uint8_t pixelIsSet = column & 0x01;
+        uint8_t run = 0;
+
+        do {
+          run++;
+          column >>= 1;
+        } while (((j + run) < fullCharacterHeight) &&
+                 ((column & 0x01) == pixelIsSet));
+
+        if (pixelIsSet || drawBackground)
         {
-          column = pgm_read_byte(bitmap++);
+          uint16_t h = run * size;
+          fillRect(x + (i * size), y + (j * size), size,
+                   (h > 255) ? 255 : h, pixelIsSet ? color : bg);
         }
+        j += run;
       }
+    }
+    return;
+  }
 
-      // pixelIsSet should be a bool but at the time of writing,
-      // the GCC AVR compiler generates less code if it's a uint8_t
-      uint8_t pixelIsSet = column & 0x01;
+  // For size 1, each column is shifted into position, using a multiply like
+  // Sprites::drawBitmap(), and written to the one or two screen buffer bytes
+  // that it overlaps.
+  markDirty(x, y, fullCharacterWidth, fullCharacterHeight);
 
-      if (pixelIsSet || drawBackground)
-      {
-        for (uint8_t a = 0; a < size; a++)
-        {
-          for (uint8_t b = 0; b < size; b++)
-          {
-            drawPixel(x + (i * size) + a, y + (j * size) + b,
-                      pixelIsSet ? color : bg);
-          }
-        }
-      }
-      column >>= 1;
+  int8_t page = y >> 3; // -1 to 7 after clipping
+  uint8_t mulAmount = 1 << (y & 7);
+
+  for (uint8_t i = 0; i < fullCharacterWidth; i++, x++)
+  {
+    uint8_t column = (i < characterWidth) ? pgm_read_byte(bitmap++) : 0;
+
+    if (x < 0 || x >= WIDTH)
+    {
+      continue;
     }
 
-    // draw the inter-line spacing pixels for this column if required
-    if (drawBackground)
+    uint8_t bgBits = drawBackground ? (~column & cellMask) : 0;
+
+    // The masks of pixels to be set, cleared and inverted
+    uint8_t setBits = 0;
+    uint8_t clearBits = 0;
+    uint8_t invertBits = 0;
+
+    switch (color)
     {
-      for (uint8_t j = characterHeight; j < fullCharacterHeight; j++)
-      {
-        for (uint8_t a = 0; a < size; a++)
-        {
-          for (uint8_t b = 0; b < size; b++)
-          {
-            drawPixel(x + (i * size) + a, y + (j * size) + b, bg);
-          }
-        }
-      }
+      case WHITE: setBits = column; break;
+      case BLACK: clearBits = column; break;
+      case INVERT: invertBits = column; break;
+    }
+    switch (bg)
+    {
+      case WHITE: setBits |= bgBits; break;
+      case BLACK: clearBits |= bgBits; break;
+      case INVERT: invertBits |= bgBits; break;
+    }
+
+    uint16_t setShifted = setBits * mulAmount;
+    uint16_t clearShifted = clearBits * mulAmount;
+    uint16_t invertShifted = invertBits * mulAmount;
+
+    int16_t index = (page * WIDTH) + x;
+
+    if (page >= 0)
+    {
+      sBuffer[index] = ((sBuffer[index] | (uint8_t)setShifted) &
+                        ~(uint8_t)clearShifted) ^ (uint8_t)invertShifted;
+    }
+    if ((mulAmount != 1) && (page < (HEIGHT / 8) - 1))
+    {
+      index += WIDTH;
+      sBuffer[index] = ((sBuffer[index] | (uint8_t)(setShifted >> 8)) &
+                        ~(uint8_t)(clearShifted >> 8)) ^
+                       (uint8_t)(invertShifted >> 8);
     }
   }
 }
 
+void Arduboy2::drawDigits(int16_t x, int16_t y, uint16_t value, uint8_t digits)
+{
+  int16_t charWidth = fullCharacterWidth * textSize;
+
+  // draw from the lowest digit, right to left
+  x += digits * charWidth;
+  while (digits-- != 0)
+  {
+    x -= charWidth;
+    drawChar(x, y, '0' + (value % 10), textColor, textBackground, textSize);
+    value /= 10;
+  }
+}
+
 void Arduboy2::setCursor(int16_t x, int16_t y)
 {
   cursor_x = x;
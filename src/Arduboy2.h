@@ -12,8 +12,6 @@
 #include "Arduboy2Core.h"
 #include "Arduboy2Audio.h"
 #include "Arduboy2Beep.h"
-#include "Sprites.h"
-#include "SpritesB.h"
 #include <Print.h>
 
 /** \brief
@@ -84,7 +82,12 @@
  * BLACK pixels will become WHITE and WHITE will become BLACK.
  *
  * \note
- * Only function Arduboy2Base::drawBitmap() currently supports this value.
+ * Only functions Arduboy2Base::drawBitmap(), Arduboy2Base::drawFastHLine(),
+ * Arduboy2Base::drawFastVLine(), Arduboy2Base::drawLine(),
+ * Arduboy2Base::fillRect(), Arduboy2Base::fillCircle(),
+ * Arduboy2Base::fillRoundRect(), Arduboy2Base::fillTriangle() and
+ * Arduboy2::drawChar() (and therefore text output) currently support this
+ * value.
  */
 #define INVERT 2
 
@@ -165,6 +168,27 @@ struct Point
   }
 };
 
+//========================================
+//========== ButtonEvent object ==========
+//========================================
+
+/** \brief
+ * A record of a single button being pressed or released.
+ *
+ * \details
+ * These are queued by the background button sampling started by
+ * `Arduboy2Base::beginButtonSampling()` and read using
+ * `Arduboy2Base::readButtonEvent()`.
+ *
+ * \see Arduboy2Base::readButtonEvent() Arduboy2Base::beginButtonSampling()
+ */
+struct ButtonEvent
+{
+  uint16_t time;  /**< The lower 16 bits of `millis()` when the change was detected */
+  uint8_t button; /**< The button that changed, such as `A_BUTTON` */
+  bool pressed;   /**< `true` if the button was pressed, `false` if released */
+};
+
 //==================================
 //========== Arduboy2Base ==========
 //==================================
@@ -423,6 +447,11 @@ class Arduboy2Base : public Arduboy2Core
    * If the "Show LEDs with boot logo" flag in system EEPROM is cleared,
    * the RGB LEDs will not be flashed during the logo display sequence.
    *
+   * If the "Quick boot logo" flag in system EEPROM is set, the logo scrolls
+   * down 4 pixels at a time, the pauses are shortened and pressing any
+   * button aborts the sequence. This brings the sequence down from over 2
+   * seconds to about half a second.
+   *
    * If the "Show Boot Logo" flag in system EEPROM is cleared, this function
    * will return without executing the logo display sequence.
    *
@@ -511,6 +540,234 @@ class Arduboy2Base : public Arduboy2Core
    */
   static void display(bool clear);
 
+  /** \brief
+   * Copy only the changed area of the display buffer to the display.
+   *
+   * \details
+   * The library's drawing functions keep track of the smallest rectangle,
+   * in columns and 8 pixel high pages, containing everything that has been
+   * drawn into the display buffer since the last time it was copied to the
+   * display. This function copies only that area to the display, and then
+   * marks the area as empty. If nothing has been drawn, nothing is copied.
+   *
+   * For sketches that only change a small part of the screen each frame,
+   * such as a score or status area, this takes much less time than
+   * `display()`, which always copies the entire buffer. However, because
+   * of the overhead of setting the display's address window and tracking
+   * the changed area, it will be slower than `display()` if most of the
+   * screen changes.
+   *
+   * Functions `display()` and `display(bool)` can still be used along with
+   * this function. They keep the changed area up to date as well.
+   *
+   * \note
+   * The changed area is only kept if `ARDUBOY2_DIRTY_TRACKING` is defined
+   * when the library is compiled, so that other sketches don't spend any
+   * time on it. It has to be set as a build option, such as
+   * `-DARDUBOY2_DIRTY_TRACKING` in the `build_flags` of a PlatformIO
+   * project, because defining it in the sketch doesn't affect the library's
+   * own source files. Without it, this function copies the entire buffer,
+   * the same as `display()`.
+   *
+   * \note
+   * If a sketch writes directly to the display buffer (`sBuffer`), or uses
+   * `drawPixel()`, it must call `markDirty()` for the area it changes, or that
+   * area may not be updated by `displayDirty()`.
+   *
+   * \see markDirty() display()
+   */
+  static void displayDirty();
+
+  /** \brief
+   * Start copying the display buffer to the display in the background.
+   *
+   * \details
+   * This function starts copying the contents of the display buffer to the
+   * display and then returns immediately. The transfer continues, one byte
+   * at a time, using the SPI transfer complete interrupt, while the sketch
+   * goes on with other work. If a previous transfer started by this function
+   * is still in progress, this function will wait for it to complete first.
+   *
+   * While the transfer is in progress the display buffer must not be
+   * changed, except for pages (rows of 8 pixels high) that have already been
+   * sent. Function `displayPagesSent()` will give the number of pages that
+   * can be safely changed, and `displayInProgress()` indicates when the
+   * transfer has completed. Functions which write to the display, such as
+   * `display()`, `displayDirty()`, `paintScreen()` or `sendLCDCommand()`,
+   * wait for the transfer to complete before sending anything.
+   *
+   * \note
+   * To give the sketch a useful amount of CPU time while the transfer is
+   * in progress, the SPI clock is reduced to 1MHz, so the transfer takes
+   * about 8.2 milliseconds. Running the interrupt for each byte uses about
+   * 3 milliseconds of CPU time in total, compared to about 1.2 milliseconds
+   * for `display()`. This function will only be an improvement over
+   * `display()` for sketches that can do useful work, such as preparing the
+   * next frame, while the transfer is in progress.
+   *
+   * \note
+   * The SPI interrupt handler used by this function is only included in a
+   * sketch that uses this function.
+   *
+   * \see displayInProgress() displayPagesSent() display()
+   */
+  static void displayAsync();
+
+  /** \brief
+   * Test if a transfer started by `displayAsync()` is still in progress.
+   *
+   * \return `true` if the transfer is still in progress.
+   *
+   * \see displayAsync() displayPagesSent()
+   */
+  static bool displayInProgress();
+
+  /** \brief
+   * Get the number of display buffer pages already sent by `displayAsync()`.
+   *
+   * \return The number of pages, from the top of the screen, that have been
+   * completely sent to the display. If no transfer is in progress, the total
+   * number of pages (`HEIGHT / 8`) is returned.
+   *
+   * \details
+   * A page is a row of display buffer bytes representing 8 pixels high by
+   * the width of the screen. While a transfer started by `displayAsync()` is
+   * in progress, the sketch can draw into the pages that have already been
+   * sent, as long as it doesn't change any of the pages below them.
+   *
+   * \see displayAsync() displayInProgress()
+   */
+  static uint8_t displayPagesSent();
+
+  /** \brief
+   * Add a rectangular area to the changed area used by `displayDirty()`.
+   *
+   * \param x The X coordinate of the top left corner of the area.
+   * \param y The Y coordinate of the top left corner of the area.
+   * \param w The width of the area.
+   * \param h The height of the area.
+   *
+   * \details
+   * The specified area, clipped to the screen, is added to the area that will
+   * be copied to the display by the next call to `displayDirty()`.
+   *
+   * This only needs to be called by a sketch that writes directly to the
+   * display buffer, or that uses `drawPixel()`. The library's other drawing
+   * functions, including those of the `Sprites` and `SpritesB` classes, do
+   * this automatically.
+   *
+   * If `ARDUBOY2_DIRTY_TRACKING` isn't defined, this function does nothing.
+   *
+   * \see displayDirty() sBuffer
+   */
+#ifdef ARDUBOY2_DIRTY_TRACKING
+  static void markDirty(int16_t x, int16_t y, int16_t w, int16_t h);
+#else
+  static void markDirty(int16_t, int16_t, int16_t, int16_t) { }
+#endif
+
+  /** \brief
+   * Scroll the view up or down, using the display's hardware start line.
+   *
+   * \param dy The number of pixels to move the view by. Positive values move
+   * the view down, so the image moves up and new rows appear at the bottom
+   * of the screen. Negative values move the view up.
+   *
+   * \details
+   * For a sketch that scrolls vertically through a large area, redrawing the
+   * whole screen to move the view by a pixel or two wastes a lot of time.
+   * Instead, this function treats the display buffer as a ring of 64 rows
+   * and moves its start, using `setDisplayStartLine()` so the display shows
+   * the buffer from the new start. Only the rows that have newly come into
+   * view need to be drawn. They are cleared to black by this function and
+   * added to the changed area for `displayDirty()`, so calling
+   * `displayDirty()` after drawing them only sends the new rows to the
+   * display.
+   *
+   * While the view is scrolled, screen row `y` is at row
+   * `viewToBufferY(y)` of the display buffer. Drawing functions still use
+   * buffer coordinates, so anything drawn must be drawn at the buffer
+   * position given by `viewToBufferY()`. Something that extends past the
+   * bottom of the buffer must also be drawn `HEIGHT` pixels higher, so that
+   * the part wrapping around to the top of the buffer is drawn too.
+   *
+   * \code{.cpp}
+   * // move the view down 2 pixels and draw the 2 new bottom rows
+   * arduboy.scrollViewVertical(2);
+   * int16_t y = arduboy.viewToBufferY(HEIGHT - 2);
+   * drawMapRows(y, mapY + HEIGHT - 2, 2);
+   * arduboy.displayDirty();
+   * \endcode
+   *
+   * The new start line isn't sent to the display straight away. It's sent
+   * by the next call to `display()` or `displayDirty()`, just after the
+   * buffer, so the screen moves at the same moment the new rows appear.
+   *
+   * \note
+   * \parblock
+   * Anything that should stay in place on the screen, such as a score, has
+   * to be erased and redrawn at its new buffer position after each scroll.
+   *
+   * `displayAsync()` doesn't send the new start line. A sketch that scrolls
+   * the view should use `display()` or `displayDirty()`.
+   * \endparblock
+   *
+   * \see viewToBufferY() scrollViewHorizontal() resetView()
+   * setDisplayStartLine()
+   */
+  static void scrollViewVertical(int8_t dy);
+
+  /** \brief
+   * Scroll the view left or right, by shifting the display buffer contents.
+   *
+   * \param dx The number of pixels to move the view by. Positive values move
+   * the view right, so the image moves left and new columns appear on the
+   * right side of the screen. Negative values move the view left.
+   *
+   * \details
+   * The display has no hardware support for moving its image sideways by a
+   * chosen amount, so this function moves the contents of the display
+   * buffer, which is much faster than redrawing them. The columns that have
+   * newly come into view are cleared to black, ready to be drawn.
+   *
+   * The entire buffer is added to the changed area for `displayDirty()`.
+   *
+   * This can be used along with `scrollViewVertical()` to scroll in both
+   * directions.
+   *
+   * \see scrollViewVertical()
+   */
+  static void scrollViewHorizontal(int8_t dx);
+
+  /** \brief
+   * Get the display buffer row for a screen row when the view is scrolled.
+   *
+   * \param y The screen row.
+   *
+   * \return The row of the display buffer shown at screen row `y`, from 0 to
+   * `HEIGHT - 1`.
+   *
+   * \see scrollViewVertical()
+   */
+  static uint8_t viewToBufferY(uint8_t y)
+  {
+    return (y + viewStart) & (HEIGHT - 1);
+  }
+
+  /** \brief
+   * Set the view back to the top of the display buffer.
+   *
+   * \details
+   * After this is called, screen rows and display buffer rows are the same
+   * again, as they are for sketches that don't use `scrollViewVertical()`.
+   * The buffer contents aren't moved, so the whole screen will normally have
+   * to be redrawn. As with `scrollViewVertical()`, the display's start line
+   * is changed by the next call to `display()` or `displayDirty()`.
+   *
+   * \see scrollViewVertical()
+   */
+  static void resetView();
+
   /** \brief
    * Set a single pixel in the display buffer to the specified color.
    *
@@ -522,6 +779,14 @@ class Arduboy2Base : public Arduboy2Core
    * The single pixel specified location in the display buffer is set to the
    * specified color. The values WHITE or BLACK can be used for the color.
    * If the `color` parameter isn't included, the pixel will be set to WHITE.
+   *
+   * \note
+   * To keep this function as fast as possible, the pixel isn't added to the
+   * changed area used by `displayDirty()`. A sketch that uses `drawPixel()`
+   * along with `displayDirty()` should call `markDirty()` for the area it
+   * draws pixels in.
+   *
+   * \see markDirty()
    */
   static void drawPixel(int16_t x, int16_t y, uint8_t color = WHITE);
 
@@ -555,6 +820,9 @@ class Arduboy2Base : public Arduboy2Core
    * \param r The radius of the circle in pixels.
    * \param color The circle's color (optional; defaults to WHITE).
    *
+   * \details
+   * The color can be WHITE, BLACK or INVERT.
+   *
    * \see drawCircle()
    */
   static void fillCircle(int16_t x0, int16_t y0, uint8_t r, uint8_t color = WHITE);
@@ -571,6 +839,12 @@ class Arduboy2Base : public Arduboy2Core
    * Bresenham's algorithm.
    * The start and end points can be at any location with respect to the other.
    *
+   * The line is clipped to the screen before it's drawn, so only the points
+   * that are on the screen take any time. Horizontal and vertical lines are
+   * drawn using `drawFastHLine()` and `drawFastVLine()`.
+   *
+   * The color can be WHITE, BLACK or INVERT.
+   *
    * \see drawFastHLine() drawFastVLine()
    */
   static void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color = WHITE);
@@ -583,6 +857,9 @@ class Arduboy2Base : public Arduboy2Core
    * \param h The height of the line.
    * \param color The color of the line (optional; defaults to WHITE).
    *
+   * \details
+   * The color can be WHITE, BLACK or INVERT.
+   *
    * \see drawFastHLine() drawLine()
    */
   static void drawFastVLine(int16_t x, int16_t y, uint8_t h, uint8_t color = WHITE);
@@ -595,6 +872,9 @@ class Arduboy2Base : public Arduboy2Core
    * \param w The width of the line.
    * \param color The color of the line (optional; defaults to WHITE).
    *
+   * \details
+   * The color can be WHITE, BLACK or INVERT.
+   *
    * \see drawFastVLine() drawLine()
    */
   static void drawFastHLine(int16_t x, int16_t y, uint8_t w, uint8_t color = WHITE);
@@ -621,6 +901,9 @@ class Arduboy2Base : public Arduboy2Core
    * \param h The height of the rectangle.
    * \param color The color of the pixel (optional; defaults to WHITE).
    *
+   * \details
+   * The color can be WHITE, BLACK or INVERT.
+   *
    * \see drawRect() drawRoundRect() fillRoundRect()
    */
   static void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t color = WHITE);
@@ -649,6 +932,9 @@ class Arduboy2Base : public Arduboy2Core
    * \param r The radius of the semicircles forming the corners.
    * \param color The color of the rectangle (optional; defaults to WHITE).
    *
+   * \details
+   * The color can be WHITE, BLACK or INVERT.
+   *
    * \see drawRoundRect() drawRect() fillRect()
    */
   static void fillRoundRect(int16_t x, int16_t y, uint8_t w, uint8_t h, uint8_t r, uint8_t color = WHITE);
@@ -678,6 +964,7 @@ class Arduboy2Base : public Arduboy2Core
    * \details
    * A triangle is drawn by specifying each of the three corner locations.
    * The corners can be at any position with respect to the others.
+   * The color can be WHITE, BLACK or INVERT.
    *
    * \see drawTriangle()
    */
@@ -803,10 +1090,97 @@ class Arduboy2Base : public Arduboy2Core
    * such as after waiting for the user to press a button to start a game, or
    * another event that takes a variable amount of time after boot.
    *
-   * \see generateRandomSeed()
+   * \see generateRandomSeed() initFastRandomSeed()
    */
   static void initRandomSeed();
 
+  /** \brief
+   * Seed the fast random number generator with a random value.
+   *
+   * \details
+   * The generator used by `fastRandom()` is seeded with the random value
+   * returned from a call to `generateRandomSeed()`. This is separate from
+   * `initRandomSeed()`, which seeds the Arduino `random()` function.
+   *
+   * \note
+   * As with `initRandomSeed()`, this function will be more effective if
+   * called after a semi-random time, such as after waiting for the user to
+   * press a button to start a game.
+   *
+   * \see fastRandom() setFastRandomSeed() generateRandomSeed()
+   */
+  static void initFastRandomSeed();
+
+  /** \brief
+   * Set the state of the fast random number generator.
+   *
+   * \param seed The seed value. A value of 0 is changed to 1.
+   *
+   * \details
+   * Seeding with the same value will always produce the same sequence of
+   * numbers from `fastRandom()`, which can be used to generate the same
+   * level or pattern each time.
+   *
+   * \see fastRandom() initFastRandomSeed()
+   */
+  static void setFastRandomSeed(uint16_t seed);
+
+  /** \brief
+   * Get a 16 bit random number from the fast random number generator.
+   *
+   * \return A random number from 1 to 65535.
+   *
+   * \details
+   * This uses a 16 bit xorshift generator, which only needs a few shifts
+   * and exclusive ORs for each number. It's much faster than the Arduino
+   * `random()` function and uses only 2 bytes of RAM for its state. The
+   * sequence repeats after 65535 numbers and never produces 0, which is
+   * fine for games but not for anything needing high quality randomness.
+   *
+   * If the generator isn't seeded, by `initFastRandomSeed()` or
+   * `setFastRandomSeed()`, it produces the same sequence each time the
+   * sketch starts.
+   *
+   * \see fastRandom(uint8_t) fastRandom(int16_t, int16_t)
+   * initFastRandomSeed()
+   */
+  static uint16_t fastRandom();
+
+  /** \brief
+   * Get a random number from 0 up to, but not including, a limit, from the
+   * fast random number generator.
+   *
+   * \param limit The upper limit. The number returned is less than this.
+   *
+   * \return A random number from 0 to `limit - 1`, or 0 if `limit` is 0.
+   *
+   * \details
+   * The number is scaled to the range with a single 8 bit multiply, instead
+   * of the division used by `random()`.
+   *
+   * \see fastRandom() fastRandom(int16_t, int16_t)
+   */
+  static uint8_t fastRandom(uint8_t limit);
+
+  /** \brief
+   * Get a random number in a range from the fast random number generator.
+   *
+   * \param min The lowest number that can be returned.
+   * \param max The upper limit, which is exclusive. The number returned is
+   * always less than this.
+   *
+   * \return A random number from `min` to `max - 1`, or `min` if `max` isn't
+   * greater than `min`.
+   *
+   * \details
+   * The number is scaled to the range with a multiply, instead of the
+   * division used by `random()`. Any range that fits in `int16_t` can be
+   * used, such as -30000 to 30000.
+   *
+   * \see fastRandom() fastRandom(uint8_t)
+   */
+  static int16_t fastRandom(int16_t min, int16_t max);
+
   /** \brief
    * Set the frame rate used by the frame control functions.
    *
@@ -912,6 +1286,288 @@ class Arduboy2Base : public Arduboy2Core
    */
   static bool nextFrameDEV();
 
+  /** \brief
+   * Set the frame rate used by `nextFrameTimer()` and start its timer.
+   *
+   * \param rate The desired frame rate in frames per second.
+   *
+   * \details
+   * This is the equivalent of `setFrameRate()` for use with
+   * `nextFrameTimer()`. Instead of counting whole milliseconds, the frames
+   * are timed by hardware timer 1, so each frame will be accurate to within a
+   * few microseconds. For example, a rate of 60 will give 60 frames per
+   * second, instead of the 62.5 that `setFrameRate(60)` gives.
+   *
+   * It can be called again at any time to change the rate.
+   *
+   * \note
+   * \parblock
+   * Timer 1 is also used by `setRGBled()` to control the brightness of the
+   * red and blue LEDs. `setRGBled()` can't be used while the frame timer is
+   * running, and will stop the frame timer working if it is. The other RGB
+   * LED functions, such as `digitalWriteRGB()`, can be used.
+   *
+   * Call `stopFrameTimer()` to stop the timer and make timer 1 available
+   * for `setRGBled()` again.
+   * \endparblock
+   *
+   * \see nextFrameTimer() stopFrameTimer() setFrameRate()
+   */
+  static void setFrameRateTimer(uint8_t rate);
+
+  /** \brief
+   * Stop the timer started by `setFrameRateTimer()`.
+   *
+   * \details
+   * Timer 1 is returned to the state set by the Arduino core, so that
+   * `setRGBled()` can be used. `nextFrameTimer()` must not be used after
+   * calling this function, unless `setFrameRateTimer()` is called again.
+   *
+   * \see setFrameRateTimer()
+   */
+  static void stopFrameTimer();
+
+  /** \brief
+   * Indicate that it's time to render the next frame, using a hardware timer.
+   *
+   * \return `true` if it's time for the next frame.
+   *
+   * \details
+   * This function is used the same way as `nextFrame()`, but the frames are
+   * timed by the hardware timer started by `setFrameRateTimer()`, which must
+   * be called first.
+   *
+   * While waiting, the CPU is put to sleep until the next interrupt, so it
+   * will wake up at the moment the frame is due, or sooner for other
+   * interrupts, such as the one used by `millis()`.
+   *
+   * `cpuLoad()`, `everyXFrames()` and `frameCount` work the same as they
+   * do when using `nextFrame()`.
+   *
+   * \code{.cpp}
+   * void setup() {
+   *   arduboy.begin();
+   *   arduboy.setFrameRateTimer(60);
+   * }
+   *
+   * void loop() {
+   *   if (!arduboy.nextFrameTimer()) {
+   *     return;
+   *   }
+   *   // render and display the next frame
+   * }
+   * \endcode
+   *
+   * \note
+   * If a frame takes longer than the time allotted, the next frame will
+   * start immediately but any further frames that would have been due are
+   * skipped, the same as with `nextFrame()`.
+   *
+   * \see setFrameRateTimer() stopFrameTimer() nextFrame()
+   */
+  static bool nextFrameTimer();
+
+  /** \brief
+   * Start displaying 3 or 4 levels of gray by showing several planes in turn.
+   *
+   * \param levels The number of gray levels, including black and white:
+   * 3 or 4 (optional; defaults to 4).
+   * \param planeRate The number of planes shown per second (optional;
+   * defaults to 135).
+   *
+   * \details
+   * The display can only show pixels as on or off. Grayscale is made by
+   * drawing each frame as a sequence of planes, each shown for the same
+   * time. A pixel lit in only some of the planes appears as a shade of gray.
+   * With 4 levels there are 3 planes per frame, and a pixel at level 0, 1, 2
+   * or 3 is lit in that many of them. With 3 levels there are 2 planes.
+   *
+   * Only the one display buffer is used. The sketch draws each plane in
+   * turn, using `getCurrentPlane()` or `grayColor()` to decide what to draw,
+   * and shows it using `displayPlane()`. The `GraySprites` class draws
+   * sprites with gray levels.
+   *
+   * The planes are timed by calling `setFrameRateTimer()` with the plane
+   * rate, so `nextFrameTimer()` is used to wait for each plane and every
+   * plane counts as a frame. The image is steadiest when the plane rate is
+   * close to the display's own refresh rate. This varies between displays,
+   * so a sketch may wish to let it be tuned with `setDisplayClock()` or by
+   * changing the plane rate.
+   *
+   * \code{.cpp}
+   * void setup() {
+   *   arduboy.begin();
+   *   arduboy.beginGrayscale();
+   * }
+   *
+   * void loop() {
+   *   if (!arduboy.nextFrameTimer()) {
+   *     return;
+   *   }
+   *   // show the plane drawn by the previous call, as soon as it is due
+   *   arduboy.displayPlane();
+   *
+   *   if (arduboy.getCurrentPlane() == 0) {
+   *     updateGame(); // once per full frame
+   *   }
+   *   arduboy.fillRect(0, 0, 32, 32, arduboy.grayColor(1)); // dark gray
+   *   arduboy.fillRect(32, 0, 32, 32, arduboy.grayColor(2)); // light gray
+   *   GraySprites::drawOverwrite(80, 16, player, 0);
+   * }
+   * \endcode
+   *
+   * \note
+   * \parblock
+   * Everything has to be drawn again for each plane, so a 4 level frame
+   * takes 3 times as much drawing as an ordinary one. Drawing and displaying
+   * each plane has to fit within one plane period, about 7.4ms at the
+   * default rate, or the planes will be shown for unequal times and the
+   * grays will flicker.
+   *
+   * Timer 1 is used, the same as with `setFrameRateTimer()`. Call
+   * `endGrayscale()` to stop it.
+   * \endparblock
+   *
+   * \see displayPlane() grayColor() GraySprites setDisplayClock()
+   */
+  static void beginGrayscale(uint8_t levels = 4, uint8_t planeRate = 135);
+
+  /** \brief
+   * Stop displaying grayscale.
+   *
+   * \details
+   * The frame timer is stopped and drawing returns to normal, with
+   * `getCurrentPlane()` staying at 0. The display clock is set back to the
+   * setting used by `boot()`.
+   *
+   * \see beginGrayscale() stopFrameTimer()
+   */
+  static void endGrayscale();
+
+  /** \brief
+   * Show the plane drawn in the display buffer and move on to the next one.
+   *
+   * \param clear If `true` the display buffer will be cleared to zero
+   * after it's sent (optional; defaults to `true`).
+   *
+   * \details
+   * This is used in grayscale mode instead of `display()`. It should be
+   * called straight after `nextFrameTimer()` returns `true`, before drawing,
+   * so that each plane is sent at the same moment relative to the timer and
+   * is shown for the same time as the others. The first call after
+   * `beginGrayscale()` shows whatever the buffer held before, for one plane.
+   *
+   * The plane returned by `getCurrentPlane()` then advances, to the one to
+   * be drawn next, wrapping back to 0 after the last plane.
+   *
+   * \see beginGrayscale() getCurrentPlane()
+   */
+  static void displayPlane(bool clear = true);
+
+  /** \brief
+   * Get the plane that is being drawn, in grayscale mode.
+   *
+   * \return The plane number, from 0 up to 1 less than the number of
+   * planes per frame.
+   *
+   * \details
+   * A pixel at a given gray level is lit in each plane with a number lower
+   * than the level. Game logic that should run once per full frame can be
+   * run when the plane is 0. When not in grayscale mode, 0 is returned.
+   *
+   * \see beginGrayscale() grayColor()
+   */
+  static uint8_t getCurrentPlane()
+  {
+    return grayPlane;
+  }
+
+  /** \brief
+   * Get the number of planes per frame, in grayscale mode.
+   *
+   * \return 3 for 4 gray levels, 2 for 3 gray levels, or 1 when not in
+   * grayscale mode.
+   *
+   * \see beginGrayscale() getCurrentPlane()
+   */
+  static uint8_t getPlaneCount()
+  {
+    return grayPlaneCount;
+  }
+
+  /** \brief
+   * Get the color to draw in the current plane for a gray level.
+   *
+   * \param level The gray level, from 0 (black) to 3 (white). With 3 levels,
+   * 2 and 3 are both white.
+   *
+   * \return `WHITE` if a pixel at the level is lit in the current plane,
+   * otherwise `BLACK`.
+   *
+   * \details
+   * The result can be passed as the color to any of the drawing functions.
+   * When not in grayscale mode, levels 1 to 3 all give `WHITE`.
+   *
+   * \see beginGrayscale() getCurrentPlane()
+   */
+  static uint8_t grayColor(uint8_t level)
+  {
+    return (level > grayPlane) ? WHITE : BLACK;
+  }
+
+  /** \brief
+   * Indicate that it's time for the next frame, and how many fixed time
+   * steps of game logic are needed to catch up.
+   *
+   * \param maxSteps The maximum number of steps to return. A value of 0 is
+   * treated as 1.
+   *
+   * \return The number of game logic steps to run before rendering the next
+   * frame, or 0 if it's not yet time for the next frame.
+   *
+   * \details
+   * This function is an alternative to `nextFrame()` for sketches that want
+   * their game logic to advance at a fixed rate, even when rendering a frame
+   * sometimes takes longer than the time allotted per frame. The step
+   * duration is the frame duration set by `setFrameRate()` or
+   * `setFrameDuration()`.
+   *
+   * Normally 1 will be returned for each frame. If a frame overruns, the
+   * next call will return the number of steps that have become due, so that
+   * the game logic can catch up by running several steps before rendering
+   * once. In effect, the frames that there wasn't time for are skipped but
+   * the game logic still runs at the same speed.
+   *
+   * If more than `maxSteps` steps are due, only `maxSteps` are returned and
+   * the rest are dropped. This prevents a very slow frame from leading to an
+   * even slower one while catching up. When steps are dropped, the game will
+   * slow down.
+   *
+   * `frameCount` is incremented once for each frame rendered, not for each
+   * step.
+   *
+   * The step timing is started by `begin()`. A sketch that uses its own
+   * initialization instead of `begin()` may get `maxSteps` steps for its
+   * first frame.
+   *
+   * \code{.cpp}
+   * void loop() {
+   *   uint8_t steps = arduboy.nextFrameSteps(4);
+   *   if (steps == 0) {
+   *     return;
+   *   }
+   *   while (steps--) {
+   *     updateGame(); // advance the game by one fixed time step
+   *   }
+   *   drawGame();
+   *   arduboy.display(CLEAR_BUFFER);
+   * }
+   * \endcode
+   *
+   * \see nextFrame() setFrameRate() setFrameDuration() FrameProfiler
+   */
+  static uint8_t nextFrameSteps(uint8_t maxSteps);
+
   /** \brief
    * Indicate if the specified number of frames has elapsed.
    *
@@ -1112,6 +1768,86 @@ class Arduboy2Base : public Arduboy2Core
    */
   static bool justReleased(uint8_t button);
 
+  /** \brief
+   * Start sampling the buttons in the background.
+   *
+   * \details
+   * The buttons are sampled about once every millisecond by an interrupt
+   * handler and debounced. Each debounced change is queued as a `ButtonEvent`,
+   * which can be read using `readButtonEvent()`. `pollSampledButtons()` can be
+   * used in place of `pollButtons()` to update `currentButtonState` and
+   * `previousButtonState` from the sampled state, so `justPressed()` and
+   * `justReleased()` can still be used.
+   *
+   * Since sampling is done independently of the frame rate, presses shorter
+   * than a frame aren't lost, and events record when each change happened.
+   *
+   * The sampling uses the timer 0 compare match A interrupt. Timer 0 keeps
+   * running as normal for `millis()` and `setRGBled()`.
+   *
+   * \see endButtonSampling() pollSampledButtons() readButtonEvent()
+   */
+  static void beginButtonSampling();
+
+  /** \brief
+   * Stop sampling the buttons in the background.
+   *
+   * \details
+   * Any events still in the queue can continue to be read using
+   * `readButtonEvent()`.
+   *
+   * \see beginButtonSampling()
+   */
+  static void endButtonSampling();
+
+  /** \brief
+   * Update the button states from the buttons sampled in the background.
+   *
+   * \details
+   * This is the equivalent of `pollButtons()` for use with
+   * `beginButtonSampling()`. It should be called once at the start of each
+   * new frame.
+   *
+   * `currentButtonState` is set to the debounced state of the buttons. In
+   * addition, any button that was pressed at any time since the previous call
+   * is included, even if it has since been released. This makes sure that
+   * `justPressed()` will return `true` for a press shorter than a frame, with
+   * `justReleased()` returning `true` for the following frame.
+   *
+   * \see beginButtonSampling() pollButtons() justPressed() justReleased()
+   */
+  static void pollSampledButtons();
+
+  /** \brief
+   * Read the oldest button event from the queue.
+   *
+   * \param event A `ButtonEvent` to be filled in with the event.
+   *
+   * \return `true` if an event was read. `false` if the queue is empty, in
+   * which case `event` is unchanged.
+   *
+   * \details
+   * Events are queued by the background sampling started by
+   * `beginButtonSampling()`. There is a separate event for each button
+   * pressed or released, in the order in which they occurred.
+   *
+   * \code{.cpp}
+   * ButtonEvent event;
+   * while (arduboy.readButtonEvent(event)) {
+   *   if (event.pressed && event.button == A_BUTTON) {
+   *     fire();
+   *   }
+   * }
+   * \endcode
+   *
+   * \note
+   * The queue holds up to 7 events. If it's full, newer events are
+   * discarded, so events should be read at least once per frame.
+   *
+   * \see beginButtonSampling() ButtonEvent
+   */
+  static bool readButtonEvent(ButtonEvent& event);
+
   /** \brief
    * Test if a point falls within a rectangle.
    *
@@ -1145,6 +1881,46 @@ class Arduboy2Base : public Arduboy2Core
    */
   static bool collide(Rect rect1, Rect rect2);
 
+  /** \brief
+   * Test if the set pixels of two sprites are touching.
+   *
+   * \param x1,y1 The location of the first sprite.
+   * \param bitmap1 The first sprite's bitmap, in `Sprites` format.
+   * \param frame1 The frame number of the first sprite's bitmap.
+   * \param x2,y2 The location of the second sprite.
+   * \param bitmap2 The second sprite's bitmap, in `Sprites` format.
+   * \param frame2 The frame number of the second sprite's bitmap.
+   *
+   * \return `true` if there's at least one location where a pixel is set in
+   * both bitmaps.
+   *
+   * \details
+   * Unlike testing the sprites' bounding rectangles, this only detects a
+   * collision when the shapes themselves overlap, so transparent corners and
+   * gaps don't count. Only the area where the two bitmaps overlap is
+   * examined, 8 pixels at a time, and the test stops at the first pixel
+   * found to be set in both.
+   *
+   * For a sprite drawn using a separate mask, with
+   * `Sprites::drawExternalMask()`, the mask is normally the bitmap to use here,
+   * since it gives the sprite's full shape. The combined image and mask
+   * format used by `Sprites::drawPlusMask()` isn't supported.
+   *
+   * The locations are the same as would be given to the `Sprites` functions
+   * to draw the sprites, but they don't have to be on the screen.
+   *
+   * \note
+   * Because this takes much longer than `collide(Rect, Rect)`, it's best
+   * used only for pairs of objects whose bounding rectangles have already
+   * been found to be intersecting.
+   *
+   * \see collide(Rect, Rect) CollisionGrid Sprites
+   */
+  static bool collide(int16_t x1, int16_t y1,
+                      const uint8_t *bitmap1, uint8_t frame1,
+                      int16_t x2, int16_t y2,
+                      const uint8_t *bitmap2, uint8_t frame2);
+
   /** \brief
    * Read the unit ID from system EEPROM.
    *
@@ -1169,7 +1945,12 @@ class Arduboy2Base : public Arduboy2Core
    * The ID can be any value. It is intended to allow different units to be
    * uniquely identified.
    *
-   * \see readUnitID() writeUnitName()
+   * \note
+   * The change is written to EEPROM immediately, unless
+   * `beginSystemEEPROMUpdate()` has been called. In that case it's written
+   * by the next call to `commitSystemEEPROM()`.
+   *
+   * \see readUnitID() writeUnitName() beginSystemEEPROMUpdate()
    */
   static void writeUnitID(uint16_t id);
 
@@ -1245,8 +2026,14 @@ class Arduboy2Base : public Arduboy2Core
    * allocate an array to hold the unit name string, instead of using a
    * hard coded value for the size.
    *
+   * \note
+   * The change is written to EEPROM immediately, unless
+   * `beginSystemEEPROMUpdate()` has been called. In that case it's written
+   * by the next call to `commitSystemEEPROM()`.
+   *
    * \see readUnitName() writeUnitID() Arduboy2::bootLogoExtra()
-   * ARDUBOY_UNIT_NAME_BUFFER_SIZE ARDUBOY_UNIT_NAME_LEN Arduboy2::font5x7
+   * beginSystemEEPROMUpdate() ARDUBOY_UNIT_NAME_BUFFER_SIZE ARDUBOY_UNIT_NAME_LEN
+   * Arduboy2::font5x7
    */
   static void writeUnitName(const char* name);
 
@@ -1278,7 +2065,12 @@ class Arduboy2Base : public Arduboy2Core
    * boot logo sequence is to be displayed when the system boots up.
    * This function allows the flag to be saved with the desired value.
    *
-   * \see readShowBootLogoFlag() bootLogo()
+   * \note
+   * The change is written to EEPROM immediately, unless
+   * `beginSystemEEPROMUpdate()` has been called. In that case it's written
+   * by the next call to `commitSystemEEPROM()`.
+   *
+   * \see readShowBootLogoFlag() bootLogo() beginSystemEEPROMUpdate()
    */
   static void writeShowBootLogoFlag(bool val);
 
@@ -1309,8 +2101,13 @@ class Arduboy2Base : public Arduboy2Core
    * unit name is to be displayed at the end of the boot logo sequence.
    * This function allows the flag to be saved with the desired value.
    *
+   * \note
+   * The change is written to EEPROM immediately, unless
+   * `beginSystemEEPROMUpdate()` has been called. In that case it's written
+   * by the next call to `commitSystemEEPROM()`.
+   *
    * \see readShowUnitNameFlag() writeUnitName() readUnitName()
-   * Arduboy2::bootLogoExtra()
+   * Arduboy2::bootLogoExtra() beginSystemEEPROMUpdate()
    */
   static void writeShowUnitNameFlag(bool val);
 
@@ -1341,10 +2138,116 @@ class Arduboy2Base : public Arduboy2Core
    * displayed. This function allows the flag to be saved with the desired
    * value.
    *
-   * \see readShowBootLogoLEDsFlag()
+   * \note
+   * The change is written to EEPROM immediately, unless
+   * `beginSystemEEPROMUpdate()` has been called. In that case it's written
+   * by the next call to `commitSystemEEPROM()`.
+   *
+   * \see readShowBootLogoLEDsFlag() beginSystemEEPROMUpdate()
    */
   static void writeShowBootLogoLEDsFlag(bool val);
 
+  /** \brief
+   * Read the "Quick boot logo" flag in system EEPROM.
+   *
+   * \return `true` if the flag is set to indicate that a shortened boot logo
+   * sequence should be used. `false` for the full sequence.
+   *
+   * \details
+   * The "Quick boot logo" flag is used to determine whether the boot logo
+   * sequence should be shortened. When it's set, the logo scrolls down
+   * faster, it and the unit name are shown for less time, and pressing any
+   * button, rather than only RIGHT, ends the sequence. This function returns
+   * the value of this flag.
+   *
+   * \see writeQuickBootLogoFlag() bootLogoShell()
+   */
+  static bool readQuickBootLogoFlag();
+
+  /** \brief
+   * Write the "Quick boot logo" flag in system EEPROM.
+   *
+   * \param val If `true` the flag is set to indicate that a shortened boot
+   * logo sequence should be used. If `false` the full sequence is used.
+   *
+   * \details
+   * The "Quick boot logo" flag is used to determine whether the boot logo
+   * sequence should be shortened. This function allows the flag to be saved
+   * with the desired value.
+   *
+   * \note
+   * The change is written to EEPROM immediately, unless
+   * `beginSystemEEPROMUpdate()` has been called. In that case it's written
+   * by the next call to `commitSystemEEPROM()`.
+   *
+   * \see readQuickBootLogoFlag() beginSystemEEPROMUpdate()
+   */
+  static void writeQuickBootLogoFlag(bool val);
+
+  /** \brief
+   * Start a group of system EEPROM setting changes, to be written together.
+   *
+   * \details
+   * Normally, the functions that change system EEPROM settings, such as
+   * `writeUnitID()` and `writeShowBootLogoFlag()`, write the change to EEPROM
+   * right away. After this function is called, they instead only change the
+   * library's copy of the system EEPROM area, held in RAM, and the changed
+   * bytes are written all at once by `commitSystemEEPROM()`. Bytes that
+   * end up with the same value as before aren't written.
+   *
+   * This allows several settings to be changed, with the EEPROM only being
+   * written when the changes are to be saved, or not at all if they're
+   * abandoned using `discardSystemEEPROMChanges()`.
+   *
+   * \code{.cpp}
+   * arduboy.beginSystemEEPROMUpdate();
+   * arduboy.writeUnitName(newName);
+   * arduboy.writeShowUnitNameFlag(true);
+   * arduboy.commitSystemEEPROM(); // save both changes
+   * \endcode
+   *
+   * \note
+   * Changes that aren't committed are lost when the power is turned off.
+   * Changes made by `Arduboy2Audio::saveOnOff()` are also held back until
+   * they're committed.
+   *
+   * \see commitSystemEEPROM() discardSystemEEPROMChanges()
+   */
+  static void beginSystemEEPROMUpdate();
+
+  /** \brief
+   * Write a group of system EEPROM setting changes.
+   *
+   * \details
+   * All the system EEPROM setting changes made since
+   * `beginSystemEEPROMUpdate()` was called are written to EEPROM, and the
+   * setting write functions go back to writing each change right away.
+   * If nothing has been changed, nothing is written.
+   *
+   * \see beginSystemEEPROMUpdate() discardSystemEEPROMChanges() writeUnitID()
+   * writeUnitName() writeShowBootLogoFlag() writeShowUnitNameFlag()
+   * writeShowBootLogoLEDsFlag() writeQuickBootLogoFlag()
+   */
+  static void commitSystemEEPROM();
+
+  /** \brief
+   * Discard any changes made to system EEPROM settings that haven't been
+   * written.
+   *
+   * \details
+   * Changes made since `beginSystemEEPROMUpdate()` was called are discarded,
+   * and the RAM copy of the system EEPROM area will be reloaded the next time
+   * a setting is read. The setting write functions go back to writing each
+   * change right away.
+   *
+   * This function should also be called if a sketch writes to the system
+   * EEPROM area directly, using the `EEPROM` library, so that the library's
+   * copy doesn't hold the old values.
+   *
+   * \see beginSystemEEPROMUpdate() commitSystemEEPROM()
+   */
+  static void discardSystemEEPROMChanges();
+
   /** \brief
    * A counter which is incremented once per frame.
    *
@@ -1460,7 +2363,7 @@ class Arduboy2Base : public Arduboy2Core
    * this library manipulate the contents of the display buffer. A sketch can
    * also access the display buffer directly.
    *
-   * \see getBuffer()
+   * \see getBuffer() markDirty()
    */
   static uint8_t sBuffer[(HEIGHT*WIDTH)/8];
 
@@ -1499,26 +2402,95 @@ class Arduboy2Base : public Arduboy2Core
   static void drawLogoSpritesBSelfMasked(int16_t y);
   static void drawLogoSpritesBOverwrite(int16_t y);
 
-  // draw one or more "corners" of a circle
+  // draw one or more "corners" of a circle, leaving out the points on the
+  // axes
   static void drawCircleHelper(int16_t x0, int16_t y0, uint8_t r, uint8_t corners,
                         uint8_t color = WHITE);
 
+  // draw the spans of a circle's outline for a run of points with the same y
+  static void drawCircleRun(int16_t x0, int16_t y0, uint8_t xStart,
+                            uint8_t xEnd, uint8_t y, uint8_t corners,
+                            uint8_t color, uint8_t clip);
+
   // draw one or both vertical halves of a filled-in circle or
   // rounded rectangle edge
   static void fillCircleHelper(int16_t x0, int16_t y0, uint8_t r,
                         uint8_t sides, int16_t delta, uint8_t color = WHITE);
 
+  // fill the columns of a filled-in circle at a distance from its center
+  static void fillCircleColumns(int16_t x0, int16_t y0, uint8_t dx,
+                                uint8_t dy, uint8_t sides, int16_t delta,
+                                uint8_t color, uint8_t clip);
+
+  // For shapes drawn as a number of spans (filled rectangles).
+  // clipShape() checks the bounding box of a whole shape once and returns
+  // one of the values below, which is then passed to fillSpan() for each
+  // span. Spans of a shape that's entirely on the screen skip clipping.
+  static constexpr uint8_t shapeHidden = 0;  // entirely off the screen
+  static constexpr uint8_t shapeClipped = 1; // partly off the screen
+  static constexpr uint8_t shapeVisible = 2; // entirely on the screen
+  static uint8_t clipShape(int16_t x, int16_t y, int16_t w, int16_t h);
+  static void fillSpan(int16_t x, int16_t y, uint8_t w, uint8_t h,
+                       uint8_t color, uint8_t clip);
+
+  // fill a rectangle known to be entirely on the screen
+  static void fillRectUnclipped(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
+                                uint8_t color);
+
   // helper for drawCompressed()
   class BitStreamReader;
 
   // swap the values of two int16_t variables passed by reference
   static void swapInt16(int16_t& a, int16_t& b);
 
+  // For displayDirty()
+#ifdef ARDUBOY2_DIRTY_TRACKING
+  // add an area, already clipped to the screen, to the changed area
+  static void expandDirty(uint8_t colStart, uint8_t colEnd,
+                          uint8_t pageStart, uint8_t pageEnd);
+  // set the changed area to empty
+  static void resetDirty();
+  // the changed area, in columns and pages. start > end if empty
+  static uint8_t dirtyColStart;
+  static uint8_t dirtyColEnd;
+  static uint8_t dirtyPageStart;
+  static uint8_t dirtyPageEnd;
+#else
+  // without tracking these do nothing, and are compiled away
+  static void expandDirty(uint8_t, uint8_t, uint8_t, uint8_t) { }
+  static void resetDirty() { }
+#endif
+
   // For frame functions
   static uint8_t eachFrameMillis;
   static uint8_t thisFrameStart;
   static uint8_t lastFrameDurationMs;
   static bool justRendered;
+  static uint16_t nextStepTime;
+
+  // The display buffer row shown at the top of the screen
+  static uint8_t viewStart;
+  // true if viewStart has to be sent to the display
+  static bool viewStartChanged;
+  // send a changed viewStart, after the buffer has been sent
+  static void sendViewStart();
+
+  // The state of the fast random number generator
+  static uint16_t fastRandomState;
+
+  // For grayscale mode
+  static uint8_t grayPlane; // the plane being drawn
+  static uint8_t grayPlaneCount; // the number of planes per frame
+
+  // Read and write the RAM copy of system EEPROM
+  static uint8_t readSysEEPROM(uint16_t address);
+  static void writeSysEEPROM(uint16_t address, uint8_t value);
+
+  // For the RAM copy of system EEPROM
+  static uint8_t sysEEPROM[EEPROM_STORAGE_SPACE_START];
+  static bool sysEEPROMLoaded;
+  static bool sysEEPROMDeferred; // changes are held until committed
+  static uint16_t sysEEPROMChanged; // a bit for each changed address
 
   // ----- Map of EEPROM addresses for system use-----
 
@@ -1548,6 +2520,9 @@ class Arduboy2Base : public Arduboy2Core
     // Flash the RGB led during the boot logo
   static constexpr uint8_t sysFlagShowLogoLEDsBit = 2;
   static constexpr uint8_t sysFlagShowLogoLEDsMask = _BV(sysFlagShowLogoLEDsBit);
+    // Run the full length boot logo sequence (cleared for a quick sequence)
+  static constexpr uint8_t sysFlagFullLogoBit = 3;
+  static constexpr uint8_t sysFlagFullLogoMask = _BV(sysFlagFullLogoBit);
 };
 
 
@@ -1754,6 +2729,11 @@ class Arduboy2 : public Print, public Arduboy2Base
    * If the "Show LEDs with boot logo" flag in system EEPROM is cleared,
    * the RGB LEDs will not be flashed during the logo display sequence.
    *
+   * If the "Quick boot logo" flag in system EEPROM is set, the logo scrolls
+   * down 4 pixels at a time, the pauses are shortened and pressing any
+   * button aborts the sequence. This brings the sequence down from over 2
+   * seconds to about half a second.
+   *
    * If the "Show Boot Logo" flag in system EEPROM is cleared, this function
    * will return without executing the logo display sequence.
    *
@@ -1841,6 +2821,9 @@ class Arduboy2 : public Print, public Arduboy2Base
    * corner of the character. The character will be rendered using the
    * library's `font5x7` font.
    *
+   * The colors can be WHITE, BLACK or INVERT. The background is only drawn
+   * if its color is different from the foreground color.
+   *
    * \note
    * This is a low level function used by the `write()` function to draw a
    * character. Although it's available as a public function, it wouldn't
@@ -1851,6 +2834,35 @@ class Arduboy2 : public Print, public Arduboy2Base
    */
   static void drawChar(int16_t x, int16_t y, uint8_t c, uint8_t color, uint8_t bg, uint8_t size);
 
+  /** \brief
+   * Draw a number with a fixed number of digits at the specified location in
+   * the screen buffer.
+   *
+   * \param x The X coordinate, in pixels, of the left edge of the number.
+   * \param y The Y coordinate, in pixels, of the top edge of the number.
+   * \param value The number to draw.
+   * \param digits The number of digits to draw.
+   *
+   * \details
+   * Exactly `digits` characters are drawn, with leading zeros added as
+   * needed. If the number has more digits than this, only the lowest ones
+   * are drawn. The current text color, background and size are used, the
+   * same as for printed text, but the text cursor isn't used or moved.
+   *
+   * This is faster than printing a number, for things like a score that
+   * are drawn every frame. The characters are drawn directly using
+   * `drawChar()`, without the number being formatted as a string or passed
+   * through the `Print` class functions.
+   *
+   * \code{.cpp}
+   * arduboy.drawDigits(WIDTH - 30, 0, score, 5); // "00120"
+   * \endcode
+   *
+   * \see drawChar() setTextColor() setTextBackground() setTextSize()
+   * TextCache
+   */
+  static void drawDigits(int16_t x, int16_t y, uint16_t value, uint8_t digits);
+
   /** \brief
    * Set the location of the text cursor.
    *
@@ -2229,5 +3241,10 @@ class Arduboy2 : public Print, public Arduboy2Base
   static constexpr uint8_t fullCharacterHeight = characterHeight + lineSpacing;
 };
 
+// These are included after the Arduboy2Base class is defined so that their
+// header only (template) functions can use it
+#include "Sprites.h"
+#include "SpritesB.h"
+
 #endif
 
@@ -42,12 +42,12 @@ void Arduboy2Audio::toggle()
 
 void Arduboy2Audio::saveOnOff()
 {
-  EEPROM.update(Arduboy2Base::eepromAudioOnOff, audio_enabled);
+  Arduboy2Base::writeSysEEPROM(Arduboy2Base::eepromAudioOnOff, audio_enabled);
 }
 
 void Arduboy2Audio::begin()
 {
-  if (EEPROM.read(Arduboy2Base::eepromAudioOnOff))
+  if (Arduboy2Base::readSysEEPROM(Arduboy2Base::eepromAudioOnOff))
     on();
   else
     off();
@@ -358,5 +358,132 @@ class BeepPin2
   }
 };
 
-#endif
 
+/** \brief
+ * Play a two voice score in the background, using both speaker pins.
+ *
+ * \details
+ * A score is an array in program memory containing a sequence of commands,
+ * written using the `BEEP_SCORE_` macros. Voice 0 is played using
+ * `BeepPin1` and voice 1 using `BeepPin2`. Once `play()` is called,
+ * the score is played by an interrupt handler, so the sketch doesn't need to
+ * call `BeepPin1::timer()` or `BeepPin2::timer()`, and the timing of notes
+ * isn't affected by the frame rate or by slow frames.
+ *
+ * The score is timed in ticks. The length of a tick, in units of about 1ms,
+ * is set by the `BEEP_SCORE_TEMPO()` command and is initially 16.
+ * `BEEP_SCORE_WAIT()` waits for the given number of ticks before the next
+ * command. Commands between waits take effect at the same time.
+ *
+ * | Command                          | Bytes | Action                                   |
+ * |----------------------------------|-------|------------------------------------------|
+ * | `BEEP_SCORE_TONE(voice, count)`  | 3     | Start a tone on the voice                |
+ * | `BEEP_SCORE_STOP(voice)`         | 1     | Stop the tone on the voice               |
+ * | `BEEP_SCORE_WAIT(ticks)`         | 1     | Wait for 1 to 127 ticks                  |
+ * | `BEEP_SCORE_TEMPO(ms)`           | 2     | Set the tick length to 1 to 255 units    |
+ * | `BEEP_SCORE_REPEAT`              | 1     | Continue from the start of the score     |
+ * | `BEEP_SCORE_END`                 | 1     | Stop both voices and end the score       |
+ *
+ * The `count` for `BEEP_SCORE_TONE()` is a `BeepPin1` count for both voices,
+ * and so should be given using `BeepPin1::freq()`. For voice 1 it's converted
+ * to the equivalent `BeepPin2` count, so the frequency must be within the
+ * range `BeepPin2` can play.
+ *
+ * \code{.cpp}
+ * const uint8_t score[] PROGMEM = {
+ *   BEEP_SCORE_TEMPO(10),
+ *   BEEP_SCORE_TONE(0, BeepPin1::freq(523.25)), // C5 melody
+ *   BEEP_SCORE_TONE(1, BeepPin1::freq(130.81)), // C3 bass
+ *   BEEP_SCORE_WAIT(20),
+ *   BEEP_SCORE_TONE(0, BeepPin1::freq(659.25)), // E5
+ *   BEEP_SCORE_WAIT(20),
+ *   BEEP_SCORE_STOP(0),
+ *   BEEP_SCORE_WAIT(20),
+ *   BEEP_SCORE_END
+ * };
+ *
+ * BeepScore::play(score);
+ * \endcode
+ *
+ * If sound is muted, as indicated by `Arduboy2Audio::enabled()`, the score
+ * continues to be timed but tones aren't started.
+ *
+ * \note
+ * \parblock
+ * The score is timed using the timer 0 compare match B interrupt, which runs
+ * alongside `millis()`. `BeepPin1` and `BeepPin2` functions shouldn't be used
+ * at the same time as a score is playing.
+ *
+ * A score that uses `BEEP_SCORE_REPEAT` must contain at least one
+ * `BEEP_SCORE_WAIT()`.
+ * \endparblock
+ *
+ * \see BeepPin1 BeepPin2 Arduboy2Audio
+ */
+class BeepScore
+{
+ public:
+
+  /** \brief
+   * Start playing a score.
+   *
+   * \param score A pointer to the score array in program memory.
+   *
+   * \details
+   * The hardware for both `BeepPin1` and `BeepPin2` is set up, so their
+   * `begin()` functions don't need to be called. A score that is already
+   * playing is replaced.
+   */
+  static void play(const uint8_t *score);
+
+  /** \brief
+   * Stop the score that is playing, and both tones.
+   */
+  static void stop();
+
+  /** \brief
+   * Check if a score is playing.
+   *
+   * \return `true` if a score is playing. `false` if it has reached its
+   * `BEEP_SCORE_END` command or has been stopped.
+   */
+  static bool playing();
+};
+
+/** \brief
+ * Score command: Start a tone on a voice. A `BeepScore` command.
+ * \param voice The voice: 0 for speaker pin 1, 1 for speaker pin 2.
+ * \param count A `BeepPin1` count, as given by `BeepPin1::freq()`.
+ */
+#define BEEP_SCORE_TONE(voice, count) \
+  (0x80 | (voice)), ((count) >> 8), ((count) & 0xFF)
+
+/** \brief
+ * Score command: Stop the tone on a voice. A `BeepScore` command.
+ * \param voice The voice: 0 for speaker pin 1, 1 for speaker pin 2.
+ */
+#define BEEP_SCORE_STOP(voice) (0x90 | (voice))
+
+/** \brief
+ * Score command: Wait for 1 to 127 ticks. A `BeepScore` command.
+ */
+#define BEEP_SCORE_WAIT(ticks) (ticks)
+
+/** \brief
+ * Score command: Set the length of a tick to 1 to 255 units of about 1ms.
+ * A `BeepScore` command.
+ */
+#define BEEP_SCORE_TEMPO(ms) 0xE0, (ms)
+
+/** \brief
+ * Score command: Continue from the start of the score. A `BeepScore`
+ * command.
+ */
+#define BEEP_SCORE_REPEAT 0xF1
+
+/** \brief
+ * Score command: Stop both voices and end the score. A `BeepScore` command.
+ */
+#define BEEP_SCORE_END 0xF0
+
+#endif
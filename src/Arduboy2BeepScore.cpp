@@ -0,0 +1,119 @@
+/**
+ * @file Arduboy2BeepScore.cpp
+ * \brief
+ * A class to play a two voice score in the background on the Arduboy speaker
+ * pins.
+ *
+ * \details
+ * This is kept in its own file so that the timer 0 compare match B interrupt
+ * handler is only linked into sketches that use it.
+ */
+
+#include "Arduboy2.h"
+#include <util/atomic.h>
+
+static const uint8_t *scoreStart;
+static const uint8_t *scorePos;    // the next command to be performed
+static uint8_t tickLength;         // timer 0 cycles per tick
+static uint8_t tickCountdown;      // timer 0 cycles until the next tick
+static uint8_t waitCountdown;      // ticks until the next command
+
+void BeepScore::play(const uint8_t *score)
+{
+  stop();
+  BeepPin1::begin();
+  BeepPin2::begin();
+
+  scoreStart = scorePos = score;
+  tickLength = 16;
+  tickCountdown = 1; // start on the next interrupt
+  waitCountdown = 0;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    TIFR0 = _BV(OCF0B);
+    TIMSK0 |= _BV(OCIE0B);
+  }
+}
+
+void BeepScore::stop()
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    TIMSK0 &= ~_BV(OCIE0B);
+  }
+  BeepPin1::noTone();
+  BeepPin2::noTone();
+}
+
+bool BeepScore::playing()
+{
+  return bit_is_set(TIMSK0, OCIE0B);
+}
+
+// Timer 0 compare match B interrupt, used by BeepScore::play()
+ISR(TIMER0_COMPB_vect)
+{
+  if (--tickCountdown != 0) {
+    return;
+  }
+  tickCountdown = tickLength;
+
+  if (waitCountdown != 0 && --waitCountdown != 0) {
+    return;
+  }
+
+  const uint8_t *p = scorePos;
+
+  while (true) {
+    uint8_t cmd = pgm_read_byte(p++);
+
+    if (cmd < 0x80) { // BEEP_SCORE_WAIT
+      if (cmd != 0) {
+        waitCountdown = cmd;
+        break;
+      }
+      continue;
+    }
+
+    switch (cmd & 0xF0) {
+      case 0x80: { // BEEP_SCORE_TONE
+        uint16_t count = (pgm_read_byte(p) << 8) | pgm_read_byte(p + 1);
+        p += 2;
+        if (Arduboy2Audio::enabled()) {
+          if (cmd & 0x01) {
+            // BeepPin2 is clocked at 1/16 the rate of BeepPin1
+            BeepPin2::tone(((count + 1) >> 4) - 1);
+          }
+          else {
+            BeepPin1::tone(count);
+          }
+        }
+        break;
+      }
+
+      case 0x90: // BEEP_SCORE_STOP
+        if (cmd & 0x01) {
+          BeepPin2::noTone();
+        }
+        else {
+          BeepPin1::noTone();
+        }
+        break;
+
+      case 0xE0: // BEEP_SCORE_TEMPO
+        tickLength = tickCountdown = pgm_read_byte(p++);
+        break;
+
+      default:
+        if (cmd == BEEP_SCORE_REPEAT) {
+          p = scoreStart;
+          break;
+        }
+        // BEEP_SCORE_END
+        TIMSK0 &= ~_BV(OCIE0B);
+        BeepPin1::noTone();
+        BeepPin2::noTone();
+        return;
+    }
+  }
+  scorePos = p;
+}
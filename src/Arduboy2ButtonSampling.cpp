@@ -0,0 +1,113 @@
+/**
+ * @file Arduboy2ButtonSampling.cpp
+ * \brief
+ * Background button sampling functions for the Arduboy2Base class.
+ *
+ * \details
+ * These are kept in their own file so that the timer 0 compare match A
+ * interrupt handler is only linked into sketches that use them.
+ */
+
+#include "Arduboy2.h"
+#include <util/atomic.h>
+
+// the number of consecutive identical samples (about 1ms apart) required
+// before a change in the buttons is accepted
+static constexpr uint8_t debounceSamples = 4;
+
+// the number of events the queue can hold (must be a power of 2)
+static constexpr uint8_t eventQueueSize = 8;
+
+static uint8_t lastSample;             // the previous raw sample
+static uint8_t sampleCount;            // identical samples of lastSample
+static volatile uint8_t sampledState;  // the debounced button state
+static volatile uint8_t pressedLatch;  // presses since pollSampledButtons()
+
+static ButtonEvent eventQueue[eventQueueSize];
+static volatile uint8_t eventHead; // written only by the interrupt handler
+static volatile uint8_t eventTail; // written only by readButtonEvent()
+
+void Arduboy2Base::beginButtonSampling()
+{
+  lastSample = sampledState = buttonsState();
+  sampleCount = debounceSamples;
+
+  // Timer 0 is already running for millis(). The compare match happens once
+  // per timer cycle regardless of the value of OCR0A, so OCR0A can be left
+  // as is for setRGBled().
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    TIFR0 = _BV(OCF0A);
+    TIMSK0 |= _BV(OCIE0A);
+  }
+}
+
+void Arduboy2Base::endButtonSampling()
+{
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    TIMSK0 &= ~_BV(OCIE0A);
+  }
+}
+
+void Arduboy2Base::pollSampledButtons()
+{
+  uint8_t state;
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    state = sampledState | pressedLatch;
+    pressedLatch = 0;
+  }
+  previousButtonState = currentButtonState;
+  currentButtonState = state;
+}
+
+bool Arduboy2Base::readButtonEvent(ButtonEvent& event)
+{
+  uint8_t tail = eventTail;
+
+  if (tail == eventHead) {
+    return false;
+  }
+  event = eventQueue[tail];
+  eventTail = (tail + 1) & (eventQueueSize - 1);
+  return true;
+}
+
+// Timer 0 compare match A interrupt, used by beginButtonSampling()
+ISR(TIMER0_COMPA_vect)
+{
+  uint8_t sample = Arduboy2Core::buttonsState();
+
+  if (sample != lastSample) {
+    lastSample = sample;
+    sampleCount = 1;
+    return;
+  }
+  if (sampleCount >= debounceSamples) {
+    return; // stable and already accepted
+  }
+  if (++sampleCount < debounceSamples) {
+    return;
+  }
+
+  // the new state has been stable long enough to accept
+  uint8_t changed = sample ^ sampledState;
+  uint16_t now = millis();
+  uint8_t head = eventHead;
+
+  for (uint8_t button = 1; button != 0; button <<= 1) {
+    if (changed & button) {
+      uint8_t next = (head + 1) & (eventQueueSize - 1);
+
+      if (next != eventTail) { // discard the event if the queue is full
+        ButtonEvent& e = eventQueue[head];
+        e.time = now;
+        e.button = button;
+        e.pressed = (sample & button) != 0;
+        head = next;
+      }
+    }
+  }
+  eventHead = head;
+  pressedLatch |= sample & changed;
+  sampledState = sample;
+}
@@ -23,7 +23,7 @@ const PROGMEM uint8_t Arduboy2Core::lcdBootProgram[] = {
   // Display Off
   // 0xAE,
 
-  // Set Display Clock Divisor v = 0xF0
+  // Set Display Clock Divisor v = 0xF0 (OLED_DEFAULT_CLOCK)
   // default is 0x80
   0xD5, 0xF0,
 
@@ -219,11 +219,13 @@ void Arduboy2Core::bootOLED()
 
 void Arduboy2Core::LCDDataMode()
 {
+  waitDisplayAsync();
   bitSet(DC_PORT, DC_BIT);
 }
 
 void Arduboy2Core::LCDCommandMode()
 {
+  waitDisplayAsync();
   bitClear(DC_PORT, DC_BIT);
 }
 
@@ -238,6 +240,7 @@ void Arduboy2Core::bootSPI()
 // Write to the SPI bus (MOSI pin)
 void Arduboy2Core::SPItransfer(uint8_t data)
 {
+  waitDisplayAsync();
   SPDR = data;
   /*
    * The following NOP introduces a small delay that can prevent the wait
@@ -334,6 +337,8 @@ void Arduboy2Core::paintScreen(uint8_t image[], bool clear)
 {
   uint16_t count;
 
+  waitDisplayAsync();
+
   asm volatile (
     "   ldi   %A[count], %[len_lsb]               \n\t" //for (len = WIDTH * HEIGHT / 8)
     "   ldi   %B[count], %[len_msb]               \n\t"
@@ -364,6 +369,8 @@ void Arduboy2Core::paintScreen(uint8_t image[], bool clear)
   uint8_t c;
   int i = 0;
 
+  waitDisplayAsync();
+
   if (clear)
   {
     SPDR = image[i]; // set the first SPI data byte to get things started
@@ -397,6 +404,74 @@ void Arduboy2Core::paintScreen(uint8_t image[], bool clear)
 }
 #endif
 
+// paint only the given column and page range of an image in RAM
+void Arduboy2Core::paintScreenRegion(const uint8_t image[],
+                                     uint8_t colStart, uint8_t colEnd,
+                                     uint8_t pageStart, uint8_t pageEnd)
+{
+  setDisplayWindow(colStart, colEnd, pageStart, pageEnd);
+
+  const uint8_t* row = image + (pageStart * WIDTH) + colStart;
+  const uint8_t width = colEnd - colStart + 1;
+  uint8_t pages = pageEnd - pageStart + 1;
+
+  do {
+    const uint8_t* p = row;
+    uint8_t count = width;
+
+    // same "closed loop" method as the reference version of paintScreen()
+    SPDR = *p++;
+    while (--count != 0)
+    {
+      uint8_t c = *p++;
+      while (!(SPSR & _BV(SPIF))) { } // wait for the previous byte to be sent
+      SPDR = c;
+    }
+    while (!(SPSR & _BV(SPIF))) { } // wait for the last byte to be sent
+
+    row += WIDTH;
+  } while (--pages != 0);
+
+  // restore the full screen window for paintScreen()
+  setDisplayWindow(0, WIDTH - 1, 0, (HEIGHT / 8) - 1);
+}
+
+// paint full width pages from an array holding only those pages
+void Arduboy2Core::paintPages(const uint8_t pages[], uint8_t pageStart,
+                              uint8_t pageCount)
+{
+  setDisplayWindow(0, WIDTH - 1, pageStart, pageStart + pageCount - 1);
+
+  uint16_t count = pageCount * WIDTH;
+
+  // same "closed loop" method as the reference version of paintScreen()
+  SPDR = *pages++;
+  while (--count != 0)
+  {
+    uint8_t c = *pages++;
+    while (!(SPSR & _BV(SPIF))) { } // wait for the previous byte to be sent
+    SPDR = c;
+  }
+  while (!(SPSR & _BV(SPIF))) { } // wait for the last byte to be sent
+
+  // restore the full screen window for paintScreen()
+  setDisplayWindow(0, WIDTH - 1, 0, (HEIGHT / 8) - 1);
+}
+
+// set the display RAM area that following data bytes will be written to
+void Arduboy2Core::setDisplayWindow(uint8_t colStart, uint8_t colEnd,
+                                    uint8_t pageStart, uint8_t pageEnd)
+{
+  LCDCommandMode();
+  SPItransfer(OLED_SET_COLUMN_ADDRESS);
+  SPItransfer(colStart);
+  SPItransfer(colEnd);
+  SPItransfer(OLED_SET_PAGE_ADDRESS);
+  SPItransfer(pageStart);
+  SPItransfer(pageEnd);
+  LCDDataMode();
+}
+
 void Arduboy2Core::blank()
 {
   for (int i = 0; i < (HEIGHT*WIDTH)/8; i++)
@@ -436,6 +511,19 @@ void Arduboy2Core::flipHorizontal(bool flipped)
   sendLCDCommand(flipped ? OLED_HORIZ_FLIPPED : OLED_HORIZ_NORMAL);
 }
 
+// set the display RAM row shown at the top of the screen
+void Arduboy2Core::setDisplayStartLine(uint8_t line)
+{
+  sendLCDCommand(OLED_SET_START_LINE | (line & (HEIGHT - 1)));
+}
+
+// set the display clock divide ratio and oscillator frequency
+void Arduboy2Core::setDisplayClock(uint8_t setting)
+{
+  sendLCDCommand(OLED_SET_CLOCK);
+  sendLCDCommand(setting);
+}
+
 /* RGB LED */
 
 void Arduboy2Core::setRGBled(uint8_t red, uint8_t green, uint8_t blue)
@@ -237,6 +237,14 @@
 #define OLED_HORIZ_FLIPPED 0xA0 // reversed segment re-map
 #define OLED_HORIZ_NORMAL 0xA1 // normal segment re-map
 
+#define OLED_SET_COLUMN_ADDRESS 0x21 // set column start and end address
+#define OLED_SET_PAGE_ADDRESS 0x22 // set page start and end address
+
+#define OLED_SET_START_LINE 0x40 // set display start line (OR with 0 to 63)
+
+#define OLED_SET_CLOCK 0xD5 // set clock divide ratio and oscillator frequency
+#define OLED_DEFAULT_CLOCK 0xF0 // the setting used by boot()
+
 // -----
 
 #define WIDTH 128 /**< The width of the display in pixels */
@@ -559,6 +567,61 @@ class Arduboy2Core : public Arduboy2NoUSB
      */
     static void paintScreen(uint8_t image[], bool clear = false);
 
+    /** \brief
+     * Paints a rectangular area of an image in RAM directly to the display.
+     *
+     * \param image A byte array in RAM representing the entire contents of
+     * the display.
+     * \param colStart The first column (0 to `WIDTH - 1`) to paint.
+     * \param colEnd The last column (`colStart` to `WIDTH - 1`) to paint.
+     * \param pageStart The first page (0 to `HEIGHT / 8 - 1`) to paint.
+     * \param pageEnd The last page (`pageStart` to `HEIGHT / 8 - 1`) to paint.
+     *
+     * \details
+     * Only the bytes of the specified array that fall within the given
+     * column and page range are written to the display. The rest of the
+     * display is left unchanged. The array has the same format as for
+     * `paintScreen(uint8_t image[], bool clear)`, where a page is a row of
+     * bytes representing 8 vertical pixels.
+     *
+     * The display's address window is set to the area being painted and is
+     * then restored to the full screen before this function returns.
+     *
+     * No range checking is done, so the parameters must be within the ranges
+     * given above.
+     *
+     * \see paintScreen() Arduboy2Base::displayDirty()
+     */
+    static void paintScreenRegion(const uint8_t image[],
+                                  uint8_t colStart, uint8_t colEnd,
+                                  uint8_t pageStart, uint8_t pageEnd);
+
+    /** \brief
+     * Paint full width pages to the display from an array holding only those
+     * pages.
+     *
+     * \param pages A byte array in RAM holding `pageCount` pages, each of
+     * `WIDTH` bytes.
+     * \param pageStart The display page (0 to `HEIGHT / 8 - 1`) to paint the
+     * first page of the array to.
+     * \param pageCount The number of pages to paint.
+     *
+     * \details
+     * This is for sketches that build the screen a few pages at a time in a
+     * small buffer, such as `StripRenderer`, rather than in the full size
+     * display buffer. The format of each page is the same as for
+     * `paintScreen()`.
+     *
+     * As with `paintScreenRegion()`, the display's address window is
+     * restored to the full screen before this function returns.
+     *
+     * No range checking is done, so the pages must be within the screen.
+     *
+     * \see paintScreenRegion() StripRenderer
+     */
+    static void paintPages(const uint8_t pages[], uint8_t pageStart,
+                           uint8_t pageCount);
+
     /** \brief
      * Blank the display screen by setting all pixels off.
      *
@@ -642,6 +705,49 @@ class Arduboy2Core : public Arduboy2NoUSB
      */
     static void flipHorizontal(bool flipped);
 
+    /** \brief
+     * Set the row of display RAM that is shown at the top of the screen.
+     *
+     * \param line The display RAM row, from 0 to 63, to show at the top of
+     * the screen.
+     *
+     * \details
+     * The display shows its RAM starting from the given row, wrapping back
+     * to row 0 after row 63. Since `display()` copies the display buffer to
+     * display RAM unchanged, this moves the image up by `line` pixels, with
+     * the top rows appearing again at the bottom, without anything being
+     * redrawn or sent to the display.
+     *
+     * The start line remains set until it's changed by calling this function
+     * again. It's set back to 0 by `boot()` and `displayOn()`.
+     *
+     * \see Arduboy2Base::scrollViewVertical()
+     */
+    static void setDisplayStartLine(uint8_t line);
+
+    /** \brief
+     * Set the display controller's clock, which sets its refresh rate.
+     *
+     * \param setting The clock setting. The upper 4 bits select the
+     * oscillator frequency, from 0 (slowest) to 15 (fastest). The lower 4 bits
+     * are one less than the amount the oscillator is divided by, from 0 (divide
+     * by 1) to 15 (divide by 16).
+     *
+     * \details
+     * The display scans its rows continuously, refreshing the whole screen at a
+     * rate set by this clock. `boot()` sets it to `OLED_DEFAULT_CLOCK`, which
+     * is the fastest oscillator frequency with no division. The exact rate
+     * varies from one display to another, so a sketch that needs the refresh
+     * to keep in step with its own timing, such as when using
+     * `Arduboy2Base::beginGrayscale()`, may provide a way for it to be tuned.
+     *
+     * The setting remains until this function is called again or the
+     * display is booted again.
+     *
+     * \see Arduboy2Base::beginGrayscale()
+     */
+    static void setDisplayClock(uint8_t setting);
+
     /** \brief
      * Send a single command byte to the display.
      *
@@ -892,6 +998,14 @@ class Arduboy2Core : public Arduboy2NoUSB
     static void bootOLED();
     static void bootPins();
     static void bootPowerSaving();
+    static void setDisplayWindow(uint8_t colStart, uint8_t colEnd,
+                                 uint8_t pageStart, uint8_t pageEnd);
+    // wait for a transfer started by Arduboy2Base::displayAsync() to finish.
+    // Its SPI interrupt is only enabled while the transfer is in progress.
+    static void waitDisplayAsync()
+    {
+      while (bit_is_set(SPCR, SPIE)) { }
+    }
 
     static const PROGMEM uint8_t lcdBootProgram[];
 };
@@ -0,0 +1,110 @@
+/**
+ * @file Arduboy2DisplayAsync.cpp
+ * \brief
+ * Interrupt driven display buffer transfer functions for the Arduboy2Base
+ * class.
+ *
+ * \details
+ * These are kept in their own file so that the SPI interrupt handler is
+ * only linked into sketches that use them.
+ */
+
+#include "Arduboy2.h"
+#include <util/atomic.h>
+
+// the next byte of sBuffer to be sent by the SPI interrupt handler
+static uint8_t* volatile asyncDisplayPtr;
+
+void Arduboy2Base::displayAsync()
+{
+  // wait for a previous transfer to complete
+  while (displayInProgress()) { }
+
+  resetDirty();
+  asyncDisplayPtr = sBuffer + 1;
+
+  // slow the SPI clock to CPU clock / 16 so the interrupt handler doesn't
+  // use all of the CPU time
+  SPCR = _BV(SPE) | _BV(MSTR) | _BV(SPR0);
+  SPSR = 0;
+  (void)SPSR; // read SPSR then write SPDR to make sure SPIF is cleared
+  SPDR = sBuffer[0];
+  SPCR = _BV(SPIE) | _BV(SPE) | _BV(MSTR) | _BV(SPR0);
+}
+
+bool Arduboy2Base::displayInProgress()
+{
+  return bit_is_set(SPCR, SPIE);
+}
+
+uint8_t Arduboy2Base::displayPagesSent()
+{
+  uint8_t* p;
+
+  if (!displayInProgress()) {
+    return HEIGHT / 8;
+  }
+
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    p = asyncDisplayPtr;
+  }
+  return (p - sBuffer) / WIDTH;
+}
+
+// SPI transfer complete interrupt, used by displayAsync()
+//
+// The C equivalent would be:
+//
+// if (asyncDisplayPtr != sBuffer + ((WIDTH * HEIGHT) / 8)) {
+//   SPDR = *asyncDisplayPtr++;
+// }
+// else { // the last byte has been sent
+//   // disable this interrupt and restore the SPI clock to CPU clock / 2
+//   SPCR = _BV(SPE) | _BV(MSTR);
+//   SPSR = _BV(SPI2X);
+// }
+//
+// but the compiler generated version saves and restores many more registers
+// than are needed, which matters because this is run for every byte.
+ISR(SPI_STC_vect, ISR_NAKED)
+{
+  asm volatile
+  (
+    "push r24                     \n"
+    "in   r24, __SREG__           \n"
+    "push r24                     \n"
+    "push r30                     \n"
+    "push r31                     \n"
+    "lds  r30, %[ptr]             \n"
+    "lds  r31, %[ptr]+1           \n"
+    "cpi  r30, lo8(%[end])        \n" // if (asyncDisplayPtr == end)
+    "ldi  r24, hi8(%[end])        \n"
+    "cpc  r31, r24                \n"
+    "breq 1f                      \n" //   goto 1
+    "ld   r24, Z+                 \n" // SPDR = *asyncDisplayPtr++
+    "out  %[spdr], r24            \n"
+    "sts  %[ptr]+1, r31           \n"
+    "sts  %[ptr], r30             \n"
+    "rjmp 2f                      \n"
+    "1:                           \n"
+    "ldi  r24, %[spcr_val]        \n" // SPCR = _BV(SPE) | _BV(MSTR)
+    "out  %[spcr], r24            \n"
+    "ldi  r24, %[spsr_val]        \n" // SPSR = _BV(SPI2X)
+    "out  %[spsr], r24            \n"
+    "2:                           \n"
+    "pop  r31                     \n"
+    "pop  r30                     \n"
+    "pop  r24                     \n"
+    "out  __SREG__, r24           \n"
+    "pop  r24                     \n"
+    "reti                         \n"
+    :
+    : [ptr]      "i" (&asyncDisplayPtr),
+      [end]      "i" (Arduboy2Base::sBuffer + ((WIDTH * HEIGHT) / 8)),
+      [spdr]     "I" (_SFR_IO_ADDR(SPDR)),
+      [spcr]     "I" (_SFR_IO_ADDR(SPCR)),
+      [spsr]     "I" (_SFR_IO_ADDR(SPSR)),
+      [spcr_val] "M" (_BV(SPE) | _BV(MSTR)),
+      [spsr_val] "M" (_BV(SPI2X))
+  );
+}
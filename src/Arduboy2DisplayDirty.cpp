@@ -0,0 +1,91 @@
+/**
+ * @file Arduboy2DisplayDirty.cpp
+ * \brief
+ * Changed area tracking for the displayDirty() function of the Arduboy2Base
+ * class.
+ *
+ * \details
+ * The changed area is only kept if ARDUBOY2_DIRTY_TRACKING is defined when
+ * the library is compiled. Otherwise markDirty(), expandDirty() and
+ * resetDirty() are empty inline functions in Arduboy2.h, and displayDirty()
+ * copies the whole buffer.
+ */
+
+#include "Arduboy2.h"
+
+#ifdef ARDUBOY2_DIRTY_TRACKING
+
+// the whole screen is initially considered changed
+uint8_t Arduboy2Base::dirtyColStart = 0;
+uint8_t Arduboy2Base::dirtyColEnd = WIDTH - 1;
+uint8_t Arduboy2Base::dirtyPageStart = 0;
+uint8_t Arduboy2Base::dirtyPageEnd = (HEIGHT / 8) - 1;
+
+void Arduboy2Base::displayDirty()
+{
+  if (dirtyColStart <= dirtyColEnd) {
+    paintScreenRegion(sBuffer, dirtyColStart, dirtyColEnd,
+                      dirtyPageStart, dirtyPageEnd);
+    resetDirty();
+  }
+  sendViewStart();
+}
+
+void Arduboy2Base::markDirty(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  int16_t xEnd = x + w - 1;
+  int16_t yEnd = y + h - 1;
+
+  if (w <= 0 || h <= 0 || x >= WIDTH || y >= HEIGHT || xEnd < 0 || yEnd < 0) {
+    return;
+  }
+
+  if (x < 0) {
+    x = 0;
+  }
+  if (xEnd >= WIDTH) {
+    xEnd = WIDTH - 1;
+  }
+  if (y < 0) {
+    y = 0;
+  }
+  if (yEnd >= HEIGHT) {
+    yEnd = HEIGHT - 1;
+  }
+
+  expandDirty(x, xEnd, y / 8, yEnd / 8);
+}
+
+void Arduboy2Base::expandDirty(uint8_t colStart, uint8_t colEnd,
+                               uint8_t pageStart, uint8_t pageEnd)
+{
+  if (colStart < dirtyColStart) {
+    dirtyColStart = colStart;
+  }
+  if (colEnd > dirtyColEnd) {
+    dirtyColEnd = colEnd;
+  }
+  if (pageStart < dirtyPageStart) {
+    dirtyPageStart = pageStart;
+  }
+  if (pageEnd > dirtyPageEnd) {
+    dirtyPageEnd = pageEnd;
+  }
+}
+
+void Arduboy2Base::resetDirty()
+{
+  dirtyColStart = 0xFF;
+  dirtyColEnd = 0;
+  dirtyPageStart = 0xFF;
+  dirtyPageEnd = 0;
+}
+
+#else
+
+void Arduboy2Base::displayDirty()
+{
+  display();
+}
+
+#endif
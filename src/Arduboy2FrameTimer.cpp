@@ -0,0 +1,90 @@
+/**
+ * @file Arduboy2FrameTimer.cpp
+ * \brief
+ * Hardware timer based frame control functions for the Arduboy2Base class.
+ *
+ * \details
+ * These are kept in their own file so that the timer 1 interrupt handler is
+ * only linked into sketches that use them.
+ */
+
+#include "Arduboy2.h"
+
+// set by the timer 1 interrupt handler when the next frame is due
+static volatile bool frameTimerDue;
+
+void Arduboy2Base::setFrameRateTimer(uint8_t rate)
+{
+  // find the smallest timer prescaler that the frame period fits in,
+  // for the best resolution
+  uint8_t clockSelect = _BV(CS11); // CPU clock / 8
+  uint32_t ticks = ((F_CPU / 8) + (rate / 2)) / rate;
+
+  if (ticks > 0x10000) {
+    clockSelect = _BV(CS11) | _BV(CS10); // CPU clock / 64
+    ticks = ((F_CPU / 64) + (rate / 2)) / rate;
+  }
+  if (ticks > 0x10000) {
+    clockSelect = _BV(CS12); // CPU clock / 256
+    ticks = ((F_CPU / 256) + (rate / 2)) / rate;
+  }
+
+  // the frame duration rounded down to whole milliseconds, used by cpuLoad()
+  eachFrameMillis = 1000 / rate;
+
+  // timer 1: CTC mode with OCR1A as the top
+  TIMSK1 = 0;
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12);
+  TCNT1 = 0;
+  OCR1A = ticks - 1;
+  frameTimerDue = true; // start the first frame immediately
+  TIFR1 = _BV(OCF1A);
+  TIMSK1 = _BV(OCIE1A);
+  TCCR1B = _BV(WGM12) | clockSelect;
+}
+
+void Arduboy2Base::stopFrameTimer()
+{
+  TIMSK1 = 0;
+  // restore the Arduino core's settings, used by setRGBled()
+  // (phase correct 8 bit PWM, CPU clock / 64)
+  TCCR1A = _BV(WGM10);
+  TCCR1B = _BV(CS11) | _BV(CS10);
+}
+
+bool Arduboy2Base::nextFrameTimer()
+{
+  if (justRendered) {
+    lastFrameDurationMs = (uint8_t) millis() - thisFrameStart;
+    justRendered = false;
+    return false;
+  }
+
+  cli();
+  if (!frameTimerDue) {
+    // Sleep until the next interrupt. Interrupts remain disabled until after
+    // the instruction following sei(), so the frame timer interrupt can't
+    // occur between testing the flag and sleeping.
+    SMCR = _BV(SE); // select idle mode and enable sleeping
+    sei();
+    sleep_cpu();
+    SMCR = 0; // disable sleeping
+    return false;
+  }
+  frameTimerDue = false;
+  sei();
+
+  // pre-render
+  justRendered = true;
+  thisFrameStart = (uint8_t) millis();
+  frameCount++;
+
+  return true;
+}
+
+// Timer 1 compare match A interrupt, used by nextFrameTimer()
+ISR(TIMER1_COMPA_vect)
+{
+  frameTimerDue = true;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file Arduboy2Grayscale.cpp
+ * \brief
+ * Grayscale display functions for the Arduboy2Base class.
+ *
+ * \details
+ * These are kept in their own file so that they are only linked into
+ * sketches that use them.
+ */
+
+#include "Arduboy2.h"
+
+// grayPlane and grayPlaneCount are defined in Arduboy2.cpp, so that
+// reading them using getCurrentPlane() or getPlaneCount(), as GraySprites
+// does, doesn't link this file and the frame timer it uses.
+
+void Arduboy2Base::beginGrayscale(uint8_t levels, uint8_t planeRate)
+{
+  grayPlaneCount = (levels == 3) ? 2 : 3;
+  // start on the last plane, so the first call to displayPlane() moves to
+  // plane 0 for drawing
+  grayPlane = grayPlaneCount - 1;
+  setFrameRateTimer(planeRate);
+}
+
+void Arduboy2Base::endGrayscale()
+{
+  stopFrameTimer();
+  grayPlane = 0;
+  grayPlaneCount = 1;
+  setDisplayClock(OLED_DEFAULT_CLOCK);
+}
+
+void Arduboy2Base::displayPlane(bool clear)
+{
+  display(clear);
+
+  if (++grayPlane >= grayPlaneCount) {
+    grayPlane = 0;
+  }
+}
@@ -0,0 +1,132 @@
+/**
+ * @file Arduboy2Save.cpp
+ * \brief
+ * A class to save and load a sketch's data in EEPROM, with wear leveling and
+ * error checking.
+ */
+
+#include "Arduboy2Save.h"
+#include <EEPROM.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+
+// a record is the sequence number, the data, then the CRC of both, low byte
+// first
+static constexpr uint16_t crcStart = 0xFFFF;
+
+bool SaveSlots::checkRecord(uint16_t address)
+{
+  uint16_t sum = crcStart;
+
+  for (uint16_t i = 0; i <= dataSize; i++) {
+    sum = _crc16_update(sum, EEPROM.read(address++));
+  }
+  return (EEPROM.read(address) == (uint8_t) sum) &&
+         (EEPROM.read(address + 1) == (uint8_t) (sum >> 8));
+}
+
+void SaveSlots::findNewest()
+{
+  uint16_t address = start;
+
+  // if nothing valid is found, the first save will go to slot 0
+  newestSlot = slotCount - 1;
+  sequence = 0;
+  found = false;
+
+  for (uint8_t slot = 0; slot < slotCount; slot++) {
+    uint8_t seq = EEPROM.read(address);
+
+    // the sequence number wraps, so compare using the difference
+    if (checkRecord(address) && (!found || (int8_t) (seq - sequence) > 0)) {
+      newestSlot = slot;
+      sequence = seq;
+      found = true;
+    }
+    address += dataSize + 3;
+  }
+  scanned = true;
+}
+
+bool SaveSlots::load(void *data)
+{
+  findNewest();
+  if (!found) {
+    return false;
+  }
+
+  uint16_t address = start + (newestSlot * (dataSize + 3)) + 1;
+  uint8_t *dest = (uint8_t *) data;
+
+  for (uint16_t i = 0; i < dataSize; i++) {
+    *dest++ = EEPROM.read(address++);
+  }
+  return true;
+}
+
+void SaveSlots::save(const void *data)
+{
+  beginSave(data);
+  while (!continueSave()) { }
+}
+
+void SaveSlots::beginSave(const void *data)
+{
+  if (!scanned) {
+    findNewest();
+  }
+
+  uint8_t slot = newestSlot + 1;
+
+  if (slot == slotCount) {
+    slot = 0;
+  }
+  address = start + (slot * (dataSize + 3));
+  step = 0;
+  crc = crcStart;
+  source = (const uint8_t *) data;
+}
+
+bool SaveSlots::continueSave()
+{
+  while (source != nullptr) {
+    // EEPROM can't be read while a write is in progress either
+    if (!eeprom_is_ready()) {
+      return false;
+    }
+
+    uint8_t val;
+
+    if (step == 0) {
+      val = sequence + 1;
+    }
+    else if (step <= dataSize) {
+      val = source[step - 1];
+    }
+    else if (step == dataSize + 1) {
+      val = crc;
+    }
+    else {
+      val = crc >> 8;
+    }
+
+    if (step <= dataSize) {
+      crc = _crc16_update(crc, val);
+    }
+
+    // only start a write if the byte has changed and then return without
+    // waiting for it to complete
+    EEPROM.update(address++, val);
+
+    if (++step == dataSize + 3) {
+      // the new record is complete
+      source = nullptr;
+      sequence++;
+      if (++newestSlot == slotCount) {
+        newestSlot = 0;
+      }
+      found = true;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file Arduboy2Save.h
+ * \brief
+ * A class to save and load a sketch's data in EEPROM, with wear leveling and
+ * error checking.
+ */
+
+#ifndef ARDUBOY2_SAVE_H
+#define ARDUBOY2_SAVE_H
+
+#include <Arduino.h>
+
+/** \brief
+ * Save and load a block of data in EEPROM, spread across a number of slots.
+ *
+ * \details
+ * A `SaveSlots` object manages a region of EEPROM divided into a number of
+ * equal sized slots, each large enough to hold one copy, or record, of a
+ * sketch's save data. Saves are written to the slots in turn, so each
+ * EEPROM cell is written only once for every `slotCount` saves, which
+ * spreads the wear across the whole region.
+ *
+ * Each record holds the data along with a sequence number and a 16 bit CRC.
+ * When loading, the record with a correct CRC and the newest sequence number
+ * is used. With two or more slots, a save always goes to a different slot
+ * than the newest record, so a save that's interrupted, for example by the
+ * power being switched off, leaves the previous save intact.
+ *
+ * Only bytes that differ from what's already in EEPROM are written.
+ *
+ * Writing a byte to EEPROM takes about 3.4 milliseconds, during which the
+ * CPU would normally wait. For a large save, `save()` can therefore take
+ * long enough to cause a number of frames to be missed. Instead, a save can
+ * be started with `beginSave()` and then continued by calling
+ * `continueSave()` once per frame, or more often. Each call writes only as
+ * much as it can without waiting for EEPROM, so the sketch continues to run
+ * normally while the save is in progress.
+ *
+ * \code{.cpp}
+ * #include <Arduboy2.h>
+ * #include <Arduboy2Save.h>
+ *
+ * struct GameData {
+ *   uint16_t highScore;
+ *   uint8_t level;
+ * };
+ *
+ * GameData gameData;
+ *
+ * // 4 slots, starting at the beginning of the user EEPROM area
+ * SaveSlots saveSlots(EEPROM_STORAGE_SPACE_START, sizeof(gameData), 4);
+ *
+ * void setup() {
+ *   arduboy.begin();
+ *   if (!saveSlots.load(&gameData)) {
+ *     // nothing has been saved yet, so use defaults
+ *     gameData.highScore = 0;
+ *     gameData.level = 1;
+ *   }
+ * }
+ *
+ * void loop() {
+ *   if (!arduboy.nextFrame()) {
+ *     return;
+ *   }
+ *   saveSlots.continueSave();
+ *
+ *   // ...
+ *
+ *   if (gameOver && !saveSlots.saving()) {
+ *     saveSlots.beginSave(&gameData);
+ *   }
+ * }
+ * \endcode
+ *
+ * \note
+ * The region uses `slotCount * (dataSize + 3)` bytes of EEPROM. It should
+ * start at or after `EEPROM_STORAGE_SPACE_START`, so it doesn't overwrite the
+ * system EEPROM area, and must not run past the end of EEPROM. None of this
+ * is checked.
+ *
+ * \note
+ * The number of slots must be between 1 and 127. With only one slot, each
+ * save overwrites the only record, so there's no wear leveling and a save
+ * that's interrupted loses the previous save as well. Use at least two slots
+ * to be protected against this. Changing the start address, data size or
+ * number of slots will make any existing saves unreadable.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses `SaveSlots`
+ * must also have `#include <Arduboy2Save.h>`.
+ *
+ * \see save() beginSave() load()
+ */
+class SaveSlots
+{
+ public:
+
+  /** \brief
+   * Describe the EEPROM region to be used for saving.
+   *
+   * \param start The EEPROM address of the first slot.
+   * \param dataSize The size of the data to be saved, in bytes.
+   * \param slotCount The number of slots to spread the saves across, from
+   * 1 to 127. At least 2 are needed for an interrupted save to leave the
+   * previous one intact.
+   *
+   * \details
+   * EEPROM isn't accessed until `load()`, `save()` or `beginSave()` is first
+   * called.
+   */
+  SaveSlots(uint16_t start, uint16_t dataSize, uint8_t slotCount)
+    : start(start), dataSize(dataSize), slotCount(slotCount),
+      scanned(false), found(false), source(nullptr)
+  {
+  }
+
+  /** \brief
+   * Load the newest saved data.
+   *
+   * \param data A pointer to where the data is to be loaded.
+   *
+   * \return `true` if valid saved data was found and loaded. `false` if
+   * nothing has been saved, in which case `data` hasn't been changed.
+   *
+   * \details
+   * All the slots are checked, to find the newest one with a correct CRC.
+   *
+   * This shouldn't be called while a save started by `beginSave()` is in
+   * progress.
+   */
+  bool load(void *data);
+
+  /** \brief
+   * Save data to the next slot, waiting until it has been written.
+   *
+   * \param data A pointer to the data to be saved.
+   *
+   * \details
+   * This may take several milliseconds for each byte that has changed.
+   * `beginSave()` can be used instead, to avoid missing frames.
+   *
+   * \see beginSave()
+   */
+  void save(const void *data);
+
+  /** \brief
+   * Start saving data to the next slot, without waiting.
+   *
+   * \param data A pointer to the data to be saved.
+   *
+   * \details
+   * The save is done by calling `continueSave()` repeatedly until it
+   * returns `true`. The data must not be changed until then, since it's read
+   * as it's written. The new record isn't used by `load()` until the save has
+   * completed.
+   *
+   * If a save is already in progress, it's started again with the new data.
+   *
+   * \see continueSave() saving() save()
+   */
+  void beginSave(const void *data);
+
+  /** \brief
+   * Continue a save started with `beginSave()`.
+   *
+   * \return `true` if the save has completed, or no save is in progress.
+   *
+   * \details
+   * As many bytes as possible are written without waiting for EEPROM. This
+   * is usually only one changed byte, plus any unchanged bytes after it.
+   * Calling this function once per frame will write about one changed byte
+   * per frame.
+   *
+   * \see beginSave() saving()
+   */
+  bool continueSave();
+
+  /** \brief
+   * Check if a save started with `beginSave()` is in progress.
+   *
+   * \return `true` if `continueSave()` must still be called to complete a
+   * save.
+   */
+  bool saving() const
+  {
+    return source != nullptr;
+  }
+
+ private:
+  void findNewest();
+  bool checkRecord(uint16_t address);
+
+  uint16_t start;
+  uint16_t dataSize;
+  uint8_t slotCount;
+
+  bool scanned;        // the newest record has been looked for
+  bool found;          // a valid record was found or has been saved
+  uint8_t newestSlot;  // the slot holding the newest record
+  uint8_t sequence;    // the sequence number of the newest record
+
+  // the save in progress
+  const uint8_t *source;
+  uint16_t address;    // the next EEPROM address to write
+  uint16_t step;       // 0 for the sequence number, then data, then CRC
+  uint16_t crc;
+};
+
+#endif
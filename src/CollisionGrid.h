@@ -0,0 +1,216 @@
+/**
+ * @file CollisionGrid.h
+ * \brief
+ * A class template for quickly finding which objects a rectangle intersects.
+ */
+
+#ifndef CollisionGrid_h
+#define CollisionGrid_h
+
+#include "Arduboy2.h"
+
+/** \brief
+ * A uniform grid over the screen, used to find the objects that a rectangle
+ * intersects without testing every object.
+ *
+ * \tparam capacity The maximum number of objects that can be added, up to
+ * 254.
+ * \tparam cellSize The width and height of each grid cell, in pixels
+ * (optional; defaults to 16). It must divide evenly into both the screen
+ * width and height.
+ *
+ * \details
+ * Testing each of a group of objects, such as bullets, against each of
+ * another group, such as enemies, using `Arduboy2Base::collide(Rect, Rect)`
+ * takes time proportional to the number in one group times the number in
+ * the other. A `CollisionGrid` reduces this by sorting the objects of one
+ * group by the grid cell their top left corner is in. Each object of the
+ * other group then only has to be tested against the objects in the few
+ * cells around it.
+ *
+ * Each object is added with an ID number, normally its index in the
+ * sketch's own array of objects, and its bounding rectangle. `query()` then
+ * calls the given function with the ID of every added object whose
+ * rectangle intersects the given one. The rectangles are tested exactly,
+ * so the results are the same as testing every object.
+ *
+ * Objects don't have to be on the screen. Those beyond an edge are kept
+ * in the cells along that edge, so they are still found correctly, but
+ * having many of them makes the grid less effective.
+ *
+ * \code{.cpp}
+ * CollisionGrid<MAX_ENEMIES> enemyGrid;
+ *
+ * // once per frame, after the enemies have moved
+ * enemyGrid.clear();
+ * for (uint8_t i = 0; i < enemyCount; i++) {
+ *   enemyGrid.add(i, enemies[i].rect);
+ * }
+ *
+ * for (uint8_t b = 0; b < bulletCount; b++) {
+ *   enemyGrid.query(bullets[b].rect, [](uint8_t id) {
+ *     enemies[id].hit = true;
+ *   });
+ * }
+ * \endcode
+ *
+ * \note
+ * Each object uses 8 bytes of RAM and each cell uses 1 byte. With the
+ * default cell size there are 32 cells.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses
+ * `CollisionGrid` must also have `#include <CollisionGrid.h>`.
+ *
+ * \see Arduboy2Base::collide(Rect, Rect) Rect
+ */
+template <uint8_t capacity, uint8_t cellSize = 16>
+class CollisionGrid
+{
+  static_assert(capacity < 0xFF, "capacity must be less than 255");
+  static_assert(cellSize != 0 && WIDTH % cellSize == 0 &&
+                HEIGHT % cellSize == 0,
+                "cellSize must divide evenly into WIDTH and HEIGHT");
+
+ public:
+  CollisionGrid()
+  {
+    clear();
+  }
+
+  /** \brief
+   * Remove all the objects.
+   *
+   * \details
+   * This would normally be done each frame, before adding the objects at
+   * their new locations.
+   */
+  void clear()
+  {
+    memset(heads, none, sizeof(heads));
+    count = 0;
+    maxWidth = 0;
+    maxHeight = 0;
+  }
+
+  /** \brief
+   * Add an object.
+   *
+   * \param id A number to identify the object in the results of `query()`.
+   * \param rect The object's bounding rectangle.
+   *
+   * \return `true` if the object was added. `false` if the grid is full.
+   */
+  bool add(uint8_t id, const Rect& rect)
+  {
+    if (count == capacity) {
+      return false;
+    }
+
+    uint8_t cell = cellIndex(rect.x, rect.y);
+    Entry& e = entries[count];
+
+    e.rect = rect;
+    e.id = id;
+    e.next = heads[cell];
+    heads[cell] = count++;
+
+    if (rect.width > maxWidth) {
+      maxWidth = rect.width;
+    }
+    if (rect.height > maxHeight) {
+      maxHeight = rect.height;
+    }
+    return true;
+  }
+
+  /** \brief
+   * Find the objects that intersect a rectangle.
+   *
+   * \param rect The rectangle to test.
+   * \param callback A function or lambda, which is called with the ID of each
+   * object found: `void callback(uint8_t id)`
+   *
+   * \return The number of objects found.
+   *
+   * \details
+   * Objects are found in no particular order.
+   */
+  template <typename Callback>
+  uint8_t query(const Rect& rect, Callback callback) const
+  {
+    if (count == 0 || rect.width == 0 || rect.height == 0) {
+      return 0;
+    }
+
+    // An object can only intersect the rectangle if its top left corner is
+    // no further up and to the left than the size of the largest object.
+    uint8_t colStart = cellColumn(rect.x - (maxWidth - 1));
+    uint8_t colEnd = cellColumn(rect.x + (rect.width - 1));
+    uint8_t rowStart = cellRow(rect.y - (maxHeight - 1));
+    uint8_t rowEnd = cellRow(rect.y + (rect.height - 1));
+    uint8_t found = 0;
+
+    for (uint8_t row = rowStart; row <= rowEnd; row++) {
+      for (uint8_t col = colStart; col <= colEnd; col++) {
+        uint8_t i = heads[(row * columns) + col];
+
+        while (i != none) {
+          const Entry& e = entries[i];
+
+          if (Arduboy2Base::collide(rect, e.rect)) {
+            callback(e.id);
+            found++;
+          }
+          i = e.next;
+        }
+      }
+    }
+    return found;
+  }
+
+  /** \brief
+   * Get the number of objects added since the grid was last cleared.
+   *
+   * \return The number of objects.
+   */
+  uint8_t size() const
+  {
+    return count;
+  }
+
+ private:
+  static constexpr uint8_t columns = WIDTH / cellSize;
+  static constexpr uint8_t rows = HEIGHT / cellSize;
+  static constexpr uint8_t none = 0xFF; // the end of a cell's list
+
+  // get the grid column or row for a coordinate, limited to the grid
+  static uint8_t cellColumn(int16_t x)
+  {
+    return (x < 0) ? 0 : (x >= WIDTH) ? columns - 1 : x / cellSize;
+  }
+
+  static uint8_t cellRow(int16_t y)
+  {
+    return (y < 0) ? 0 : (y >= HEIGHT) ? rows - 1 : y / cellSize;
+  }
+
+  static uint8_t cellIndex(int16_t x, int16_t y)
+  {
+    return (cellRow(y) * columns) + cellColumn(x);
+  }
+
+  struct Entry {
+    Rect rect;
+    uint8_t id;
+    uint8_t next; // the next entry in the same cell
+  };
+
+  Entry entries[capacity];
+  uint8_t heads[columns * rows]; // the first entry in each cell
+  uint8_t count;
+  uint8_t maxWidth;
+  uint8_t maxHeight;
+};
+
+#endif
@@ -0,0 +1,298 @@
+/**
+ * @file FrameProfiler.h
+ * \brief
+ * A class template for measuring the time taken by sections of a sketch.
+ */
+
+#ifndef FrameProfiler_h
+#define FrameProfiler_h
+
+#include "Arduboy2.h"
+#include <Print.h>
+
+/** \brief
+ * Measure the time taken by sections of code, in microseconds.
+ * **FOR USE DURING DEVELOPMENT**
+ *
+ * \tparam sectionCount The number of sections to be timed.
+ *
+ * \details
+ * `Arduboy2Base::cpuLoad()` gives the time taken by a whole frame, with a
+ * resolution of 1 millisecond. A `FrameProfiler` gives a more detailed
+ * breakdown, by timing any number of separate sections of code within a
+ * frame using `micros()`.
+ *
+ * Sections are identified by number, from 0 to `sectionCount - 1`. An `enum`
+ * makes a convenient way to name them. Each section is timed by calling
+ * `start()` before it and `stop()` after it. The minimum, maximum and average
+ * times for each section are kept until `reset()` is called.
+ *
+ * If `frame()` is called once for each frame, the number of frames and the
+ * number of those that took longer than the time allotted per frame are also
+ * counted. When using `Arduboy2Base::nextFrameSteps()`, passing it the number
+ * of steps also counts the frames skipped to catch up.
+ *
+ * The results can be printed using `printTo()` with any `Print` class object,
+ * for example `Serial` to send them over USB, or an `Arduboy2` object to draw
+ * them on the screen as an overlay.
+ *
+ * \code{.cpp}
+ * enum { LOGIC, DRAW, DISPLAY, SECTIONS };
+ * FrameProfiler<SECTIONS> profiler;
+ *
+ * void loop() {
+ *   if (!arduboy.nextFrame()) {
+ *     return;
+ *   }
+ *   profiler.frame();
+ *
+ *   profiler.start(LOGIC);
+ *   updateGame();
+ *   profiler.stop(LOGIC);
+ *
+ *   profiler.start(DRAW);
+ *   drawGame();
+ *   profiler.stop(DRAW);
+ *
+ *   if (arduboy.pressed(B_BUTTON)) {
+ *     arduboy.setCursor(0, 0);
+ *     profiler.printTo(arduboy);
+ *   }
+ *
+ *   profiler.start(DISPLAY);
+ *   arduboy.display(CLEAR_BUFFER);
+ *   profiler.stop(DISPLAY);
+ * }
+ * \endcode
+ *
+ * \note
+ * `micros()` has a resolution of 4 microseconds and each `start()` and
+ * `stop()` pair adds a few microseconds of its own. A single section
+ * measurement is limited to 65535 microseconds. Longer ones are recorded as
+ * 65535. The average is only correct for up to 65535 measurements of a
+ * section, so `reset()` should be called at least that often.
+ *
+ * \note
+ * Each section uses 14 bytes of RAM. Once a sketch is ready for release,
+ * the profiler should be removed.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses
+ * `FrameProfiler` must also have `#include <FrameProfiler.h>`.
+ *
+ * \see Arduboy2Base::cpuLoad() Arduboy2Base::nextFrameDEV()
+ */
+template <uint8_t sectionCount>
+class FrameProfiler
+{
+  public:
+    FrameProfiler()
+    {
+      reset();
+    }
+
+    /** \brief
+     * Start timing a section.
+     *
+     * \param section The section number.
+     *
+     * \see stop()
+     */
+    void start(uint8_t section)
+    {
+      sections[section].started = micros();
+    }
+
+    /** \brief
+     * Stop timing a section and add the time to its statistics.
+     *
+     * \param section The section number.
+     *
+     * \details
+     * The time is measured from the last call to `start()` for the same
+     * section.
+     *
+     * \see start()
+     */
+    void stop(uint8_t section)
+    {
+      Section& s = sections[section];
+      uint32_t elapsed = micros() - s.started;
+      uint16_t t = (elapsed > 0xFFFF) ? 0xFFFF : elapsed;
+
+      if (t < s.minTime) {
+        s.minTime = t;
+      }
+      if (t > s.maxTime) {
+        s.maxTime = t;
+      }
+      s.totalTime += t;
+      s.count++;
+    }
+
+    /** \brief
+     * Count a frame. Call once at the start of each frame.
+     *
+     * \param steps The value returned by `Arduboy2Base::nextFrameSteps()`
+     * for this frame (optional; defaults to 1).
+     *
+     * \details
+     * A frame is counted as missed if the previous frame took longer to
+     * generate than the time allotted per frame, the same as is indicated by
+     * `Arduboy2Base::nextFrameDEV()`.
+     *
+     * Each step more than 1 is counted as a skipped frame. A value of 0 is
+     * treated as 1.
+     *
+     * \see missedFrames() skippedFrames() frames()
+     */
+    void frame(uint8_t steps = 1)
+    {
+      frameCount++;
+      if (steps > 1) {
+        skippedCount += steps - 1;
+      }
+      if (Arduboy2Base::cpuLoad() > 100) {
+        missedCount++;
+      }
+    }
+
+    /** \brief
+     * Get the shortest time recorded for a section.
+     *
+     * \param section The section number.
+     *
+     * \return The minimum time in microseconds, or 0 if the section hasn't
+     * been timed since the last `reset()`.
+     */
+    uint16_t minTime(uint8_t section) const
+    {
+      return sections[section].count == 0 ? 0 : sections[section].minTime;
+    }
+
+    /** \brief
+     * Get the longest time recorded for a section.
+     *
+     * \param section The section number.
+     *
+     * \return The maximum time in microseconds.
+     */
+    uint16_t maxTime(uint8_t section) const
+    {
+      return sections[section].maxTime;
+    }
+
+    /** \brief
+     * Get the average time recorded for a section.
+     *
+     * \param section The section number.
+     *
+     * \return The average time in microseconds, or 0 if the section hasn't
+     * been timed since the last `reset()`.
+     */
+    uint16_t averageTime(uint8_t section) const
+    {
+      const Section& s = sections[section];
+      return s.count == 0 ? 0 : s.totalTime / s.count;
+    }
+
+    /** \brief
+     * Get the number of frames counted by `frame()`.
+     *
+     * \return The number of frames since the last `reset()`.
+     */
+    uint16_t frames() const
+    {
+      return frameCount;
+    }
+
+    /** \brief
+     * Get the number of frames that took longer than the time allotted.
+     *
+     * \return The number of missed frames since the last `reset()`.
+     */
+    uint16_t missedFrames() const
+    {
+      return missedCount;
+    }
+
+    /** \brief
+     * Get the number of frames skipped by running extra steps.
+     *
+     * \return The number of skipped frames since the last `reset()`.
+     *
+     * \see frame() Arduboy2Base::nextFrameSteps()
+     */
+    uint16_t skippedFrames() const
+    {
+      return skippedCount;
+    }
+
+    /** \brief
+     * Clear all the times and frame counts.
+     */
+    void reset()
+    {
+      for (uint8_t i = 0; i < sectionCount; i++) {
+        Section& s = sections[i];
+        s.minTime = 0xFFFF;
+        s.maxTime = 0;
+        s.totalTime = 0;
+        s.count = 0;
+      }
+      frameCount = 0;
+      missedCount = 0;
+      skippedCount = 0;
+    }
+
+    /** \brief
+     * Print the times and frame counts.
+     *
+     * \param out The `Print` class object to print to, for example `Serial`
+     * or an `Arduboy2` object.
+     *
+     * \details
+     * A line is printed for each section containing the section number
+     * followed by the minimum, average and maximum times in microseconds.
+     * A final line gives the number of missed frames, the number of skipped
+     * frames and the number of frames counted.
+     *
+     *     0 804 812 1020
+     *     1 2104 2390 3112
+     *     missed 3 skip 5/600
+     */
+    void printTo(Print& out) const
+    {
+      for (uint8_t i = 0; i < sectionCount; i++) {
+        out.print(i);
+        out.print(' ');
+        out.print(minTime(i));
+        out.print(' ');
+        out.print(averageTime(i));
+        out.print(' ');
+        out.println(maxTime(i));
+      }
+      out.print(F("missed "));
+      out.print(missedCount);
+      out.print(F(" skip "));
+      out.print(skippedCount);
+      out.print('/');
+      out.println(frameCount);
+    }
+
+  private:
+    struct Section {
+      uint32_t started;
+      uint16_t minTime;
+      uint16_t maxTime;
+      uint16_t count;
+      uint32_t totalTime;
+    };
+
+    Section sections[sectionCount];
+    uint16_t frameCount;
+    uint16_t missedCount;
+    uint16_t skippedCount;
+};
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * @file GraySprites.cpp
+ * \brief
+ * A class for drawing grayscale sprites, for use with
+ * `Arduboy2Base::beginGrayscale()`.
+ */
+
+#include "GraySprites.h"
+
+void GraySprites::drawOverwrite(int16_t x, int16_t y, const uint8_t *bitmap,
+                                uint8_t frame)
+{
+  Sprites::drawOverwrite(x, y, bitmap, planeFrame(frame));
+}
+
+void GraySprites::drawSelfMasked(int16_t x, int16_t y, const uint8_t *bitmap,
+                                 uint8_t frame)
+{
+  Sprites::drawSelfMasked(x, y, bitmap, planeFrame(frame));
+}
+
+void GraySprites::drawErase(int16_t x, int16_t y, const uint8_t *bitmap,
+                            uint8_t frame)
+{
+  // plane 0 holds every pixel above level 0
+  Sprites::drawErase(x, y, bitmap, frame * Arduboy2Base::getPlaneCount());
+}
+
+void GraySprites::drawExternalMask(int16_t x, int16_t y, const uint8_t *bitmap,
+                                   const uint8_t *mask, uint8_t frame,
+                                   uint8_t mask_frame)
+{
+  Sprites::drawExternalMask(x, y, bitmap, mask, planeFrame(frame),
+                            mask_frame);
+}
+
+void GraySprites::drawPlusMask(int16_t x, int16_t y, const uint8_t *bitmap,
+                               uint8_t frame)
+{
+  Sprites::drawPlusMask(x, y, bitmap, planeFrame(frame));
+}
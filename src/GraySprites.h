@@ -0,0 +1,138 @@
+/**
+ * @file GraySprites.h
+ * \brief
+ * A class for drawing grayscale sprites, for use with
+ * `Arduboy2Base::beginGrayscale()`.
+ */
+
+#ifndef GraySprites_h
+#define GraySprites_h
+
+#include "Arduboy2.h"
+
+/** \brief
+ * Draw sprites with gray levels, one plane at a time.
+ *
+ * \details
+ * These functions are the grayscale versions of the `Sprites` functions of
+ * the same names. Each draws the part of a sprite that belongs in the plane
+ * currently being drawn, as given by `Arduboy2Base::getCurrentPlane()`.
+ *
+ * A grayscale sprite uses the same format as `Sprites`, but each of its
+ * frames is made of one ordinary frame for each plane, in order. In plane 0
+ * the pixels at levels 1 and above are set, in plane 1 those at levels 2 and
+ * above, and in plane 2 (used with 4 levels only) those at level 3. So an
+ * image for 4 levels has 3 `Sprites` frames per gray frame, and one for 3
+ * levels has 2.
+ *
+ * \code{.cpp}
+ * // an 8x8 sprite for 4 levels, with one gray frame
+ * const uint8_t player[] PROGMEM = {
+ *   8, 8, // width, height
+ *   0x3C, 0x7E, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x3C, // levels 1 and above
+ *   0x00, 0x3C, 0x7E, 0x7E, 0x7E, 0x7E, 0x3C, 0x00, // levels 2 and above
+ *   0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00, // level 3
+ * };
+ *
+ * GraySprites::drawSelfMasked(x, y, player, 0);
+ * \endcode
+ *
+ * With `drawSelfMasked()`, pixels at level 0 leave the screen unchanged.
+ * With `drawErase()`, pixels above level 0 are cleared in every plane.
+ * Masks for `drawExternalMask()` are ordinary single plane masks, and
+ * images for `drawPlusMask()` have an image and mask byte pair for each byte
+ * of each plane, with the same mask in every plane.
+ *
+ * When not in grayscale mode, each gray frame is one ordinary frame, so the
+ * sprite is drawn the same as with `Sprites`.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses `GraySprites`
+ * must also have `#include <GraySprites.h>`.
+ *
+ * \see Arduboy2Base::beginGrayscale() Sprites
+ */
+class GraySprites
+{
+ public:
+  /** \brief
+   * Draw the current plane of a grayscale sprite, replacing what's under it.
+   *
+   * \param x,y The coordinates of the top left pixel location.
+   * \param bitmap A pointer to the array containing the image frames.
+   * \param frame The gray frame number of the image to draw.
+   *
+   * \see Sprites::drawOverwrite()
+   */
+  static void drawOverwrite(int16_t x, int16_t y, const uint8_t *bitmap,
+                            uint8_t frame);
+
+  /** \brief
+   * Draw the current plane of a grayscale sprite, leaving level 0 pixels
+   * unchanged.
+   *
+   * \param x,y The coordinates of the top left pixel location.
+   * \param bitmap A pointer to the array containing the image frames.
+   * \param frame The gray frame number of the image to draw.
+   *
+   * \see Sprites::drawSelfMasked()
+   */
+  static void drawSelfMasked(int16_t x, int16_t y, const uint8_t *bitmap,
+                             uint8_t frame);
+
+  /** \brief
+   * Erase the pixels of a grayscale sprite that are above level 0.
+   *
+   * \param x,y The coordinates of the top left pixel location.
+   * \param bitmap A pointer to the array containing the image frames.
+   * \param frame The gray frame number of the image to use.
+   *
+   * \details
+   * Plane 0 of the frame holds every pixel above level 0, so it is used as
+   * the mask in all planes.
+   *
+   * \see Sprites::drawErase()
+   */
+  static void drawErase(int16_t x, int16_t y, const uint8_t *bitmap,
+                        uint8_t frame);
+
+  /** \brief
+   * Draw the current plane of a grayscale sprite, using a separate mask.
+   *
+   * \param x,y The coordinates of the top left pixel location.
+   * \param bitmap A pointer to the array containing the image frames.
+   * \param mask A pointer to the array containing the mask frames, which
+   * are ordinary single plane frames.
+   * \param frame The gray frame number of the image to draw.
+   * \param mask_frame The frame number for the mask to use.
+   *
+   * \see Sprites::drawExternalMask()
+   */
+  static void drawExternalMask(int16_t x, int16_t y, const uint8_t *bitmap,
+                               const uint8_t *mask, uint8_t frame,
+                               uint8_t mask_frame);
+
+  /** \brief
+   * Draw the current plane of a grayscale sprite, using an array containing
+   * both image and mask values.
+   *
+   * \param x,y The coordinates of the top left pixel location.
+   * \param bitmap A pointer to the array containing the image and mask
+   * frames.
+   * \param frame The gray frame number of the image to draw.
+   *
+   * \see Sprites::drawPlusMask()
+   */
+  static void drawPlusMask(int16_t x, int16_t y, const uint8_t *bitmap,
+                           uint8_t frame);
+
+ private:
+  // the Sprites frame holding the current plane of a gray frame
+  static uint8_t planeFrame(uint8_t frame)
+  {
+    return (frame * Arduboy2Base::getPlaneCount()) +
+           Arduboy2Base::getCurrentPlane();
+  }
+};
+
+#endif
@@ -9,6 +9,7 @@
 
 #include "Arduboy2.h"
 #include "SpritesCommon.h"
+#include "SpritesFixed.h"
 
 /** \brief
  * A class for drawing animated sprites from image and mask bitmaps.
@@ -43,6 +44,19 @@
  * Data for each frame after the first one immediately follows the previous
  * frame. Frame numbers start at 0.
  *
+ * Functions `drawCompressedSelfMasked()` and `drawCompressedMasked()` use a
+ * different, compressed, "sprite sheet" array format. It starts with a byte
+ * giving the number of frames, followed by a flags byte. Bit 0 of the flags
+ * is set if each frame includes a mask. Next is a table of 16 bit offsets,
+ * least significant byte first, from the start of the array to the image of
+ * each frame, every one followed by the offset to the frame's mask if masks
+ * are included. The images and masks are in the format used by
+ * `Arduboy2Base::drawCompressed()`, including their width and height.
+ * Because of the offset table, any frame can be drawn without having to
+ * decompress the frames before it. The _Cabi_ program, included with this
+ * library, will create sprite sheet arrays from PNG files when given the
+ * `-f` option.
+ *
  * \note
  * \parblock
  * A separate `SpritesB` class is available as an alternative to this class.
@@ -243,6 +257,88 @@ class Sprites
      */
     static void drawSelfMasked(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t frame);
 
+    /** \brief
+     * Draw a frame from a compressed sprite sheet using only the bits set
+     * to 1.
+     *
+     * \param x,y The coordinates of the top left pixel location.
+     * \param sheet A pointer to the compressed sprite sheet array.
+     * \param frame The frame number of the image to draw.
+     *
+     * \details
+     * This is the same as `drawSelfMasked()` except that the frame is taken
+     * from a compressed sprite sheet, as described for the `Sprites` class.
+     * Masks included in the sprite sheet are ignored.
+     *
+     * \see drawCompressedMasked() drawSelfMasked()
+     * Arduboy2Base::drawCompressed()
+     */
+    static void drawCompressedSelfMasked(int16_t x, int16_t y,
+                                         const uint8_t *sheet, uint8_t frame);
+
+    /** \brief
+     * Draw a frame from a compressed sprite sheet using the frame's mask.
+     *
+     * \param x,y The coordinates of the top left pixel location.
+     * \param sheet A pointer to the compressed sprite sheet array, which
+     * must include masks.
+     * \param frame The frame number of the image and mask to draw.
+     *
+     * \details
+     * This is the same as `drawExternalMask()`, using the same frame number
+     * for the image and mask, except that the frame is taken from a
+     * compressed sprite sheet, as described for the `Sprites` class.
+     *
+     * Pixels where the mask is 1 are set to the value of the image. The
+     * image must not have bits set to 1 where the mask is 0.
+     *
+     * \note
+     * The mask and the image are decoded separately, each with a call to
+     * `Arduboy2Base::drawCompressed()`, so this takes about twice as long as
+     * `drawCompressedSelfMasked()` for the same frame.
+     *
+     * \see drawCompressedSelfMasked() drawExternalMask()
+     * Arduboy2Base::drawCompressed()
+     */
+    static void drawCompressedMasked(int16_t x, int16_t y,
+                                     const uint8_t *sheet, uint8_t frame);
+
+    /** \brief
+     * Draw a sprite of a fixed size, known at compile time, in a fixed mode.
+     *
+     * \tparam w The width of the sprite, in pixels.
+     * \tparam h The height of the sprite, in pixels. Must be a multiple of 8.
+     * \tparam mode The drawing mode. Must be one of `SPRITE_OVERWRITE`,
+     * `SPRITE_PLUS_MASK`, `SPRITE_IS_MASK` or `SPRITE_IS_MASK_ERASE`.
+     *
+     * \param x,y The coordinates of the top left pixel location.
+     * \param bitmap A pointer to the array containing the image frames.
+     * \param frame The frame number of the image to draw.
+     *
+     * \details
+     * This draws the same as `drawOverwrite()`, `drawPlusMask()`,
+     * `drawSelfMasked()` or `drawErase()`, for a `mode` of `SPRITE_OVERWRITE`,
+     * `SPRITE_PLUS_MASK`, `SPRITE_IS_MASK` or `SPRITE_IS_MASK_ERASE`
+     * respectively. The `bitmap` array is in the same format, including the
+     * width and height in the first two bytes, but they are ignored.
+     *
+     * Because the size and mode are template parameters, the compiler
+     * generates code specifically for them, so the draw mode selection and
+     * size calculations are eliminated and the loops can be optimized. This
+     * makes drawing faster but each different combination of `w`, `h` and
+     * `mode` used adds its own code, so it's best used for the few sprite
+     * types that are drawn most often.
+     *
+     * \code{.cpp}
+     * Sprites::drawFixed<16, 16, SPRITE_PLUS_MASK>(x, y, player, frame);
+     * \endcode
+     */
+    template <uint8_t w, uint8_t h, uint8_t mode>
+    static void drawFixed(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t frame)
+    {
+      drawFixedSprite<w, h, mode>(x, y, bitmap, frame);
+    }
+
     // Master function. Needs to be abstracted into separate function for
     // every render type.
     // (Not officially part of the API)
@@ -34,6 +34,20 @@ void SpritesB::drawPlusMask(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t
 }
 
 
+void SpritesB::drawCompressedSelfMasked(int16_t x, int16_t y,
+                                        const uint8_t *sheet, uint8_t frame)
+{
+  Arduboy2Base::drawCompressed(x, y, spriteSheetFrame(sheet, frame, false), WHITE);
+}
+
+void SpritesB::drawCompressedMasked(int16_t x, int16_t y,
+                                    const uint8_t *sheet, uint8_t frame)
+{
+  // clear the pixels where the mask is set, then draw the image over them
+  Arduboy2Base::drawCompressed(x, y, spriteSheetFrame(sheet, frame, true), BLACK);
+  Arduboy2Base::drawCompressed(x, y, spriteSheetFrame(sheet, frame, false), WHITE);
+}
+
 //common functions
 void SpritesB::draw(int16_t x, int16_t y,
                    const uint8_t *bitmap, uint8_t frame,
@@ -79,6 +93,9 @@ void SpritesB::drawBitmap(int16_t x, int16_t y,
   if (bitmap == NULL)
     return;
 
+  // the whole rows of bytes written, for Arduboy2Base::displayDirty()
+  Arduboy2Base::markDirty(x, y, w, ((h + 7) / 8) * 8);
+
   // xOffset technically doesn't need to be 16 bit but the math operations
   // are measurably faster if it is
   uint16_t xOffset, ofs;
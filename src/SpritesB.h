@@ -10,6 +10,7 @@
 
 #include "Arduboy2.h"
 #include "SpritesCommon.h"
+#include "SpritesFixed.h"
 
 /** \brief
  * A class for drawing animated sprites from image and mask bitmaps.
@@ -99,6 +100,56 @@ class SpritesB
      */
     static void drawSelfMasked(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t frame);
 
+    /** \brief
+     * Draw a frame from a compressed sprite sheet using only the bits set
+     * to 1.
+     *
+     * \param x,y The coordinates of the top left pixel location.
+     * \param sheet A pointer to the compressed sprite sheet array.
+     * \param frame The frame number of the image to draw.
+     *
+     * \see Sprites::drawCompressedSelfMasked()
+     */
+    static void drawCompressedSelfMasked(int16_t x, int16_t y,
+                                         const uint8_t *sheet, uint8_t frame);
+
+    /** \brief
+     * Draw a frame from a compressed sprite sheet using the frame's mask.
+     *
+     * \param x,y The coordinates of the top left pixel location.
+     * \param sheet A pointer to the compressed sprite sheet array, which
+     * must include masks.
+     * \param frame The frame number of the image and mask to draw.
+     *
+     * \note
+     * As with `Sprites::drawCompressedMasked()`, the mask and the image are
+     * decoded separately, so this takes about twice as long as
+     * `drawCompressedSelfMasked()`.
+     *
+     * \see Sprites::drawCompressedMasked()
+     */
+    static void drawCompressedMasked(int16_t x, int16_t y,
+                                     const uint8_t *sheet, uint8_t frame);
+
+    /** \brief
+     * Draw a sprite of a fixed size, known at compile time, in a fixed mode.
+     *
+     * \tparam w The width of the sprite, in pixels.
+     * \tparam h The height of the sprite, in pixels. Must be a multiple of 8.
+     * \tparam mode The drawing mode.
+     *
+     * \param x,y The coordinates of the top left pixel location.
+     * \param bitmap A pointer to the array containing the image frames.
+     * \param frame The frame number of the image to draw.
+     *
+     * \see Sprites::drawFixed()
+     */
+    template <uint8_t w, uint8_t h, uint8_t mode>
+    static void drawFixed(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t frame)
+    {
+      drawFixedSprite<w, h, mode>(x, y, bitmap, frame);
+    }
+
     // Master function. Needs to be abstracted into separate function for
     // every render type.
     // (Not officially part of the API)
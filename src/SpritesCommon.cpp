@@ -0,0 +1,20 @@
+/**
+ * @file SpritesCommon.cpp
+ * \brief
+ * Common functions for the sprite classes.
+ */
+
+#include <Arduino.h>
+#include "SpritesCommon.h"
+
+const uint8_t* spriteSheetFrame(const uint8_t *sheet, uint8_t frame, bool mask)
+{
+  uint16_t entry = frame;
+
+  // with masks, each frame has two entries in the offset table
+  if (pgm_read_byte(sheet + 1) & SPRITE_SHEET_HAS_MASK) {
+    entry = (entry * 2) + mask;
+  }
+
+  return sheet + pgm_read_word(sheet + 2 + (entry * 2));
+}
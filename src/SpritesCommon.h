@@ -7,6 +7,8 @@
 #ifndef SpritesCommon_h
 #define SpritesCommon_h
 
+#include <stdint.h>
+
 #define SPRITE_MASKED 1
 #define SPRITE_UNMASKED 2
 #define SPRITE_OVERWRITE 2
@@ -15,4 +17,12 @@
 #define SPRITE_IS_MASK_ERASE 251
 #define SPRITE_AUTO_MODE 255
 
+// compressed sprite sheet flags (byte 1 of the sheet)
+#define SPRITE_SHEET_HAS_MASK 0x01
+
+// Get the image, or the mask if mask is true, for a compressed
+// sprite sheet frame. Shared by the Sprites and SpritesB classes.
+// (Not officially part of the API)
+const uint8_t* spriteSheetFrame(const uint8_t *sheet, uint8_t frame, bool mask);
+
 #endif
@@ -0,0 +1,111 @@
+/**
+ * @file SpritesFixed.h
+ * \brief
+ * The implementation of the `drawFixed()` functions of the `Sprites` and
+ * `SpritesB` classes.
+ *
+ * \details
+ * This file is included by `Sprites.h` and `SpritesB.h`. It shouldn't be
+ * included directly by a sketch.
+ */
+
+#ifndef SpritesFixed_h
+#define SpritesFixed_h
+
+#include "Arduboy2.h"
+#include "SpritesCommon.h"
+
+// Combine one byte of a drawFixedSprite() image with the screen buffer
+// (Not officially part of the API)
+template <uint8_t mode>
+inline void drawFixedByte(uint8_t& b, uint8_t image, uint8_t mask)
+{
+  switch (mode) {
+    case SPRITE_OVERWRITE:
+    case SPRITE_PLUS_MASK:
+      b = (b & ~mask) | image;
+      break;
+
+    case SPRITE_IS_MASK:
+      b |= image;
+      break;
+
+    case SPRITE_IS_MASK_ERASE:
+      b &= ~image;
+      break;
+  }
+}
+
+// The implementation of Sprites::drawFixed() and SpritesB::drawFixed()
+// (Not officially part of the API)
+template <uint8_t w, uint8_t h, uint8_t mode>
+void drawFixedSprite(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t frame)
+{
+  static_assert(h % 8 == 0, "drawFixed() height must be a multiple of 8");
+  static_assert(mode == SPRITE_OVERWRITE || mode == SPRITE_PLUS_MASK ||
+                mode == SPRITE_IS_MASK || mode == SPRITE_IS_MASK_ERASE,
+                "drawFixed() mode must be SPRITE_OVERWRITE, SPRITE_PLUS_MASK, "
+                "SPRITE_IS_MASK or SPRITE_IS_MASK_ERASE");
+
+  // bytes per column in each row of the frame
+  // (sprite plus mask has a mask byte following each image byte)
+  constexpr uint8_t step = (mode == SPRITE_PLUS_MASK) ? 2 : 1;
+
+  if (x + w <= 0 || x > WIDTH - 1 || y + h <= 0 || y > HEIGHT - 1) {
+    return;
+  }
+
+  // the whole rows of bytes written, for Arduboy2Base::displayDirty()
+  Arduboy2Base::markDirty(x, y, w, h);
+
+  const uint8_t *data = bitmap + 2 + (frame * (w * (h / 8) * step));
+  uint8_t yOffset = y & 7;
+  int8_t sRow = y / 8;
+  uint8_t mul_amt = 1 << yOffset;
+
+  if (y < 0 && yOffset > 0) {
+    sRow--;
+  }
+
+  uint8_t xStart = (x < 0) ? -x : 0;
+  uint8_t xEnd = (x + w > WIDTH) ? WIDTH - x : w;
+
+  for (uint8_t row = 0; row < h / 8; row++, sRow++) {
+    // skip rows entirely above the screen
+    if (sRow < -1) {
+      continue;
+    }
+    if (sRow > (HEIGHT / 8) - 1) {
+      break;
+    }
+
+    const uint8_t *src = data + (((row * w) + xStart) * step);
+    int16_t ofs = (sRow * WIDTH) + x + xStart;
+
+    for (uint8_t i = xStart; i < xEnd; i++, ofs++, src += step) {
+      uint16_t image = pgm_read_byte(src) * mul_amt;
+      uint16_t mask = 0;
+
+      // mode is a constant, so only one of these cases is compiled
+      switch (mode) {
+        case SPRITE_OVERWRITE:
+          mask = 0xFF * mul_amt;
+          break;
+
+        case SPRITE_PLUS_MASK:
+          mask = pgm_read_byte(src + 1) * mul_amt;
+          break;
+      }
+
+      if (sRow >= 0) {
+        drawFixedByte<mode>(Arduboy2Base::sBuffer[ofs], image, mask);
+      }
+      if (yOffset != 0 && sRow < (HEIGHT / 8) - 1) {
+        drawFixedByte<mode>(Arduboy2Base::sBuffer[ofs + WIDTH],
+                            image >> 8, mask >> 8);
+      }
+    }
+  }
+}
+
+#endif
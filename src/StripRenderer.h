@@ -0,0 +1,528 @@
+/**
+ * @file StripRenderer.h
+ * \brief
+ * A class template for drawing the screen a few pages at a time, using much
+ * less RAM than the full display buffer.
+ */
+
+#ifndef StripRenderer_h
+#define StripRenderer_h
+
+#include "Arduboy2.h"
+
+/** \brief
+ * Draw the screen in horizontal strips, one or more 8 pixel high pages at a
+ * time, using a small buffer in place of the 1024 byte display buffer.
+ *
+ * \tparam stripPages The number of 8 pixel high pages in each strip
+ * (optional; defaults to 1). It must be 1, 2, 4 or 8.
+ *
+ * \details
+ * The sketch provides a function that draws the whole frame. `display()`
+ * clears the strip buffer and calls the function once for each strip, from
+ * the top of the screen down, then sends the strip to the display. The
+ * drawing functions of this class clip everything to the strip currently
+ * being drawn, so the drawing function doesn't have to know which strip it
+ * is. Drawing functions that only affect part of the screen can use
+ * `inStrip()` to skip work for strips that they don't touch.
+ *
+ * The strip buffer uses `stripPages * WIDTH` bytes of RAM, so with the
+ * default of 1 page it's 128 bytes instead of 1024. The cost is that the
+ * frame is drawn 8 times with 1 page strips, although most of the work of
+ * anything outside the current strip is skipped.
+ *
+ * \code{.cpp}
+ * Arduboy2Base arduboy;
+ *
+ * void drawGame();
+ * StripRenderer<> screen(drawGame);
+ *
+ * void drawGame() {
+ *   screen.drawRect(0, 0, WIDTH, HEIGHT);
+ *   screen.drawSelfMasked(playerX, playerY, playerSprite, 0);
+ *   screen.setCursor(2, 2);
+ *   screen.print(score);
+ * }
+ *
+ * void setup() {
+ *   arduboy.boot();
+ *   arduboy.flashlight();
+ *   arduboy.systemButtons();
+ *   arduboy.audio.begin();
+ * }
+ *
+ * void loop() {
+ *   if (!arduboy.nextFrame()) {
+ *     return;
+ *   }
+ *   // update the game
+ *   screen.display();
+ * }
+ * \endcode
+ *
+ * \note
+ * The RAM used by the display buffer, `Arduboy2Base::sBuffer`, is only freed
+ * if nothing in the sketch uses it, in which case the linker leaves it out.
+ * This means the sketch must use `Arduboy2Base`, not `Arduboy2`, and must
+ * not call anything that draws to or displays the buffer. This includes
+ * `begin()`, the boot logo functions, `clear()`, `display()`, the drawing
+ * and text functions of `Arduboy2Base` and `Arduboy2`, and the `Sprites`,
+ * `SpritesB` and `Tilemap` classes. Instead of `begin()`, use the functions
+ * that it calls which don't use the buffer, as in the example above.
+ *
+ * \note
+ * The cursor set by `setCursor()` is moved by printing, so it should be set
+ * again before printing each time the drawing function is called.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses
+ * `StripRenderer` must also have `#include <StripRenderer.h>`.
+ *
+ * \see Arduboy2Core::paintPages() Arduboy2Base::boot()
+ */
+template <uint8_t stripPages = 1>
+class StripRenderer : public Print
+{
+  static_assert(stripPages == 1 || stripPages == 2 || stripPages == 4 ||
+                stripPages == 8, "stripPages must be 1, 2, 4 or 8");
+
+ public:
+  /** \brief
+   * Set the function that draws a frame.
+   *
+   * \param drawFrame The function to be called by `display()` for each strip.
+   */
+  StripRenderer(void (&drawFrame)())
+    : drawFrame(drawFrame), top(0), cursorX(0), cursorY(0), textColor(WHITE)
+  {
+  }
+
+  /** \brief
+   * Draw the frame and send it to the display, one strip at a time.
+   *
+   * \details
+   * For each strip, the strip buffer is cleared to black, the drawing
+   * function is called, and then the strip is sent to the display.
+   */
+  void display()
+  {
+    for (uint8_t page = 0; page < HEIGHT / 8; page += stripPages) {
+      top = page * 8;
+      memset(strip, 0, sizeof(strip));
+      drawFrame();
+      Arduboy2Core::paintPages(strip, page, stripPages);
+    }
+  }
+
+  /** \brief
+   * Get the screen Y coordinate of the top of the strip being drawn.
+   *
+   * \return The Y coordinate of the first row of the strip.
+   */
+  uint8_t stripTop() const
+  {
+    return top;
+  }
+
+  /** \brief
+   * Check if any rows of an area are within the strip being drawn.
+   *
+   * \param y The screen Y coordinate of the top of the area.
+   * \param h The height of the area.
+   *
+   * \return `true` if any of the area's rows are in the strip.
+   */
+  bool inStrip(int16_t y, uint8_t h) const
+  {
+    return (y < top + stripHeight) && (y + h > top);
+  }
+
+  /** \brief
+   * Fill the strip with the given color.
+   *
+   * \param color The color to fill with (optional; defaults to WHITE).
+   */
+  void fillScreen(uint8_t color = WHITE)
+  {
+    memset(strip, (color == BLACK) ? 0x00 : 0xFF, sizeof(strip));
+  }
+
+  /** \brief
+   * Set a single pixel.
+   *
+   * \param x The X coordinate of the pixel.
+   * \param y The Y coordinate of the pixel.
+   * \param color The color of the pixel (optional; defaults to WHITE).
+   * INVERT will invert the pixel.
+   */
+  void drawPixel(int16_t x, int16_t y, uint8_t color = WHITE)
+  {
+    y -= top;
+    if (x < 0 || x >= WIDTH || y < 0 || y >= stripHeight) {
+      return;
+    }
+    apply(&strip[((y / 8) * WIDTH) + x], _BV(y & 7), color);
+  }
+
+  /** \brief
+   * Draw a filled-in rectangle.
+   *
+   * \param x The X coordinate of the upper left corner.
+   * \param y The Y coordinate of the upper left corner.
+   * \param w The width of the rectangle.
+   * \param h The height of the rectangle.
+   * \param color The color of the rectangle (optional; defaults to WHITE).
+   * INVERT will invert the pixels.
+   */
+  void fillRect(int16_t x, int16_t y, uint8_t w, uint8_t h,
+                uint8_t color = WHITE)
+  {
+    int16_t xEnd = x + w;
+    int16_t yEnd = y + h - top;
+
+    y -= top;
+    if (w == 0 || h == 0 || xEnd <= 0 || x >= WIDTH ||
+        yEnd <= 0 || y >= stripHeight) {
+      return;
+    }
+    if (x < 0) {
+      x = 0;
+    }
+    if (xEnd > WIDTH) {
+      xEnd = WIDTH;
+    }
+    if (y < 0) {
+      y = 0;
+    }
+    if (yEnd > stripHeight) {
+      yEnd = stripHeight;
+    }
+
+    uint8_t page = y / 8;
+    uint8_t lastPage = (yEnd - 1) / 8;
+    uint8_t mask = 0xFF << (y & 7);
+    uint8_t lastMask = 0xFF >> (7 - ((yEnd - 1) & 7));
+
+    for (; page <= lastPage; page++) {
+      if (page == lastPage) {
+        mask &= lastMask;
+      }
+      uint8_t *p = &strip[(page * WIDTH) + x];
+
+      for (int16_t i = x; i < xEnd; i++) {
+        apply(p++, mask, color);
+      }
+      mask = 0xFF;
+    }
+  }
+
+  /** \brief
+   * Draw a horizontal line.
+   *
+   * \param x The X coordinate of the left start point.
+   * \param y The Y coordinate of the left start point.
+   * \param w The width of the line.
+   * \param color The color of the line (optional; defaults to WHITE).
+   */
+  void drawFastHLine(int16_t x, int16_t y, uint8_t w, uint8_t color = WHITE)
+  {
+    fillRect(x, y, w, 1, color);
+  }
+
+  /** \brief
+   * Draw a vertical line.
+   *
+   * \param x The X coordinate of the upper start point.
+   * \param y The Y coordinate of the upper start point.
+   * \param h The height of the line.
+   * \param color The color of the line (optional; defaults to WHITE).
+   */
+  void drawFastVLine(int16_t x, int16_t y, uint8_t h, uint8_t color = WHITE)
+  {
+    fillRect(x, y, 1, h, color);
+  }
+
+  /** \brief
+   * Draw a rectangle of a specified width and height.
+   *
+   * \param x The X coordinate of the upper left corner.
+   * \param y The Y coordinate of the upper left corner.
+   * \param w The width of the rectangle.
+   * \param h The height of the rectangle.
+   * \param color The color of the rectangle (optional; defaults to WHITE).
+   */
+  void drawRect(int16_t x, int16_t y, uint8_t w, uint8_t h,
+                uint8_t color = WHITE)
+  {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+
+  /** \brief
+   * Draw a bitmap from an array in program memory.
+   *
+   * \param x The X coordinate of the top left pixel.
+   * \param y The Y coordinate of the top left pixel.
+   * \param bitmap A pointer to the bitmap array in program memory.
+   * \param w The width of the bitmap in pixels.
+   * \param h The height of the bitmap in pixels.
+   * \param color The color of pixels for bits set to 1 in the bitmap
+   * (optional; defaults to WHITE). INVERT will invert those pixels.
+   *
+   * \details
+   * The bitmap is in the same format as for `Arduboy2Base::drawBitmap()`.
+   * Bits set to 0 in the bitmap are left unchanged.
+   */
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                  uint8_t w, uint8_t h, uint8_t color = WHITE)
+  {
+    // the same test for being off screen as Arduboy2Base::drawBitmap()
+    if (x + w <= 0 || x >= WIDTH || y + h <= 0 || y >= HEIGHT) {
+      return;
+    }
+
+    // whole bytes of the bitmap are drawn, even past its height
+    uint8_t bitmapPages = (h + 7) / 8;
+
+    y -= top;
+    if (y + (bitmapPages * 8) <= 0 || y >= stripHeight) {
+      return;
+    }
+
+    int16_t colStart = (x < 0) ? -x : 0;
+    int16_t colEnd = (x + w > WIDTH) ? WIDTH - x : w;
+
+    for (uint8_t bp = 0; bp < bitmapPages; bp++, bitmap += w) {
+      // the strip row that the top bit of this page of the bitmap goes to
+      int16_t rowY = y + (bp * 8);
+
+      if (rowY <= -8) {
+        continue;
+      }
+      if (rowY >= stripHeight) {
+        break;
+      }
+
+      int8_t page = rowY >> 3;
+      uint8_t shift = rowY & 7;
+      bool drawUpper = page >= 0;
+      bool drawLower = (shift != 0) && (page + 1 < stripPages);
+      int16_t offset = (page * WIDTH) + x;
+
+      for (int16_t i = colStart; i < colEnd; i++) {
+        uint16_t data = pgm_read_byte(bitmap + i) << shift;
+
+        if (drawUpper) {
+          apply(&strip[offset + i], data, color);
+        }
+        if (drawLower) {
+          apply(&strip[offset + WIDTH + i], data >> 8, color);
+        }
+      }
+    }
+  }
+
+  /** \brief
+   * Draw a sprite, setting the background to black.
+   *
+   * \param x The X coordinate of the top left pixel.
+   * \param y The Y coordinate of the top left pixel.
+   * \param bitmap A pointer to the array containing the image frames, in the
+   * format used by the `Sprites` class.
+   * \param frame The frame number of the image to draw.
+   *
+   * \see Sprites::drawOverwrite()
+   */
+  void drawOverwrite(int16_t x, int16_t y, const uint8_t *bitmap,
+                     uint8_t frame)
+  {
+    uint8_t w = pgm_read_byte(bitmap);
+    uint8_t h = pgm_read_byte(bitmap + 1);
+
+    // the same test for being off screen as Sprites::drawOverwrite()
+    if (y + h <= 0) {
+      return;
+    }
+    // whole pages are cleared, as Sprites::drawOverwrite() does. For a
+    // height over 248 that's 256 rows, too many for a single fillRect()
+    uint16_t clearHeight = ((h + 7) / 8) * 8;
+    if (clearHeight > 255) {
+      fillRect(x, y, w, 128, BLACK);
+      fillRect(x, y + 128, w, clearHeight - 128, BLACK);
+    }
+    else {
+      fillRect(x, y, w, clearHeight, BLACK);
+    }
+    drawBitmap(x, y, frameData(bitmap, frame), w, h, WHITE);
+  }
+
+  /** \brief
+   * Draw a sprite, setting only its white pixels.
+   *
+   * \param x The X coordinate of the top left pixel.
+   * \param y The Y coordinate of the top left pixel.
+   * \param bitmap A pointer to the array containing the image frames, in the
+   * format used by the `Sprites` class.
+   * \param frame The frame number of the image to draw.
+   *
+   * \see Sprites::drawSelfMasked()
+   */
+  void drawSelfMasked(int16_t x, int16_t y, const uint8_t *bitmap,
+                      uint8_t frame)
+  {
+    drawBitmap(x, y, frameData(bitmap, frame), pgm_read_byte(bitmap),
+               pgm_read_byte(bitmap + 1), WHITE);
+  }
+
+  /** \brief
+   * Draw a sprite, clearing the pixels that are white in the image.
+   *
+   * \param x The X coordinate of the top left pixel.
+   * \param y The Y coordinate of the top left pixel.
+   * \param bitmap A pointer to the array containing the image frames, in the
+   * format used by the `Sprites` class.
+   * \param frame The frame number of the image to draw.
+   *
+   * \see Sprites::drawErase()
+   */
+  void drawErase(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t frame)
+  {
+    drawBitmap(x, y, frameData(bitmap, frame), pgm_read_byte(bitmap),
+               pgm_read_byte(bitmap + 1), BLACK);
+  }
+
+  /** \brief
+   * Draw a sprite using a separate mask image.
+   *
+   * \param x The X coordinate of the top left pixel.
+   * \param y The Y coordinate of the top left pixel.
+   * \param bitmap A pointer to the array containing the image frames, in the
+   * format used by the `Sprites` class.
+   * \param mask A pointer to the array containing the mask frames, without
+   * the width and height bytes.
+   * \param frame The frame number of the image to draw.
+   * \param mask_frame The frame number of the mask to use.
+   *
+   * \see Sprites::drawExternalMask()
+   */
+  void drawExternalMask(int16_t x, int16_t y, const uint8_t *bitmap,
+                        const uint8_t *mask, uint8_t frame,
+                        uint8_t mask_frame)
+  {
+    uint8_t w = pgm_read_byte(bitmap);
+    uint8_t h = pgm_read_byte(bitmap + 1);
+
+    drawBitmap(x, y, mask + (mask_frame * frameSize(w, h)), w, h, BLACK);
+    drawBitmap(x, y, frameData(bitmap, frame), w, h, WHITE);
+  }
+
+  /** \brief
+   * Draw a single character from the library's `font5x7` font.
+   *
+   * \param x The X coordinate of the top left pixel of the character.
+   * \param y The Y coordinate of the top left pixel of the character.
+   * \param c The character to draw.
+   * \param color The color of the character (optional; defaults to WHITE).
+   *
+   * \details
+   * Only the pixels of the character itself are drawn. The background is left
+   * unchanged.
+   *
+   * \see Arduboy2::drawChar() Arduboy2::font5x7
+   */
+  void drawChar(int16_t x, int16_t y, uint8_t c, uint8_t color = WHITE)
+  {
+    drawBitmap(x, y, &Arduboy2::font5x7[c * charWidth], charWidth, 8, color);
+  }
+
+  /** \brief
+   * Set the location of the text cursor.
+   *
+   * \param x The X coordinate, in pixels, for the left edge of the next
+   * character printed.
+   * \param y The Y coordinate, in pixels, for the top edge of the next
+   * character printed.
+   */
+  void setCursor(int16_t x, int16_t y)
+  {
+    cursorX = x;
+    cursorY = y;
+  }
+
+  /** \brief
+   * Set the color of printed text.
+   *
+   * \param color The color of the text (WHITE, BLACK or INVERT).
+   */
+  void setTextColor(uint8_t color)
+  {
+    textColor = color;
+  }
+
+  /** \brief
+   * Write a single character at the text cursor and move the cursor.
+   *
+   * \param c The character to write.
+   *
+   * \return 1
+   *
+   * \details
+   * This is used by the `print()` functions inherited from the Arduino
+   * `Print` class. A newline character moves the cursor to the start of the
+   * next line. A carriage return is ignored. Text doesn't wrap.
+   */
+  size_t write(uint8_t c) override
+  {
+    if (c == '\n') {
+      cursorX = 0;
+      cursorY += 8;
+    }
+    else if (c != '\r') {
+      drawChar(cursorX, cursorY, c, textColor);
+      cursorX += charWidth + 1;
+    }
+    return 1;
+  }
+
+  using Print::write;
+
+ private:
+  static constexpr uint8_t stripHeight = stripPages * 8;
+  static constexpr uint8_t charWidth = 5;
+
+  // set, clear or invert the given bits of a buffer byte
+  static void apply(uint8_t *p, uint8_t bits, uint8_t color)
+  {
+    if (color == WHITE) {
+      *p |= bits;
+    }
+    else if (color == BLACK) {
+      *p &= ~bits;
+    }
+    else {
+      *p ^= bits;
+    }
+  }
+
+  static uint16_t frameSize(uint8_t w, uint8_t h)
+  {
+    return w * ((h + 7) / 8);
+  }
+
+  static const uint8_t* frameData(const uint8_t *bitmap, uint8_t frame)
+  {
+    return bitmap + 2 +
+           (frame * frameSize(pgm_read_byte(bitmap), pgm_read_byte(bitmap + 1)));
+  }
+
+  void (*drawFrame)();
+  uint8_t top; // the screen row at the top of the strip
+  int16_t cursorX;
+  int16_t cursorY;
+  uint8_t textColor;
+  uint8_t strip[stripPages * WIDTH];
+};
+
+#endif
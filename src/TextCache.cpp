@@ -0,0 +1,115 @@
+/**
+ * @file TextCache.cpp
+ * \brief
+ * A class template for text that's drawn every frame but changes rarely.
+ */
+
+#include "TextCache.h"
+
+bool TextCacheBase::update(char *text, uint8_t *columns, uint8_t maxLength,
+                           const char *newText)
+{
+  if (strncmp(text, newText, maxLength) == 0)
+  {
+    return false;
+  }
+
+  uint8_t len = 0;
+
+  while (len < maxLength && newText[len] != '\0')
+  {
+    uint8_t c = newText[len];
+    const uint8_t *glyph =
+      &Arduboy2::font5x7[c * Arduboy2::getCharacterWidth()];
+
+    text[len++] = c;
+    memcpy_P(columns, glyph, Arduboy2::getCharacterWidth());
+    columns += Arduboy2::getCharacterWidth();
+    memset(columns, 0, Arduboy2::getCharacterSpacing());
+    columns += Arduboy2::getCharacterSpacing();
+  }
+  text[len] = '\0';
+  return true;
+}
+
+void TextCacheBase::formatNumber(char *buf, uint16_t value, uint8_t digits)
+{
+  char *p = buf + 5;
+
+  if (digits > 5)
+  {
+    digits = 5;
+  }
+
+  // the digits are found lowest first, so fill the buffer from the end
+  *p = '\0';
+  do {
+    *--p = '0' + (value % 10);
+    value /= 10;
+    if (digits != 0)
+    {
+      digits--;
+    }
+  } while (value != 0 || digits != 0);
+
+  memmove(buf, p, (buf + 6) - p);
+}
+
+void TextCacheBase::drawColumns(const uint8_t *columns, uint8_t width,
+                                int16_t x, int16_t y, uint8_t color)
+{
+  if (width == 0 || x + width <= 0 || x >= WIDTH || y <= -8 || y >= HEIGHT)
+  {
+    return;
+  }
+
+  Arduboy2Base::markDirty(x, y, width, 8);
+
+  // skip the columns that are off the screen
+  uint8_t start = (x < 0) ? -x : 0;
+  uint8_t count = ((x + width > WIDTH) ? WIDTH - x : width) - start;
+
+  columns += start;
+
+  int8_t page = y >> 3;
+  uint8_t shift = y & 7;
+  uint8_t invert = (color == BLACK) ? 0xFF : 0x00;
+  uint8_t *pBuf = Arduboy2Base::sBuffer + (page * WIDTH) + x + start;
+
+  if (shift == 0)
+  {
+    // aligned with a buffer row, so the columns replace whole bytes
+    if (invert == 0)
+    {
+      memcpy(pBuf, columns, count);
+    }
+    else
+    {
+      do {
+        *pBuf++ = ~*columns++;
+      } while (--count != 0);
+    }
+    return;
+  }
+
+  // otherwise each column is split across two buffer rows
+  uint8_t upperMask = 0xFF << shift;
+  uint8_t lowerMask = 0xFF >> (8 - shift);
+  bool drawUpper = page >= 0;
+  bool drawLower = page < (HEIGHT / 8) - 1;
+  uint8_t mulAmount = 1 << shift;
+
+  do {
+    uint16_t data = (uint8_t)(*columns++ ^ invert) * mulAmount;
+
+    if (drawUpper)
+    {
+      *pBuf = (*pBuf & ~upperMask) | (uint8_t)data;
+    }
+    if (drawLower)
+    {
+      pBuf[WIDTH] = (pBuf[WIDTH] & ~lowerMask) | (uint8_t)(data >> 8);
+    }
+    pBuf++;
+  } while (--count != 0);
+}
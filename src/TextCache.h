@@ -0,0 +1,170 @@
+/**
+ * @file TextCache.h
+ * \brief
+ * A class template for text that's drawn every frame but changes rarely.
+ */
+
+#ifndef TextCache_h
+#define TextCache_h
+
+#include "Arduboy2.h"
+
+/** \brief
+ * The functions used by all sizes of `TextCache`.
+ *
+ * \details
+ * This class isn't used directly. Use `TextCache` instead.
+ */
+class TextCacheBase
+{
+ public:
+  /** \brief
+   * The width of each character in the cache, in pixels, including the space
+   * after it.
+   */
+  static constexpr uint8_t charWidth =
+    Arduboy2::getCharacterWidth() + Arduboy2::getCharacterSpacing();
+
+ protected:
+  // copy new text and render it if it differs from the current text
+  static bool update(char *text, uint8_t *columns, uint8_t maxLength,
+                     const char *newText);
+
+  // format a number as text, with leading zeros to at least the given digits
+  static void formatNumber(char *buf, uint16_t value, uint8_t digits);
+
+  // draw rendered columns, one buffer row high
+  static void drawColumns(const uint8_t *columns, uint8_t width,
+                          int16_t x, int16_t y, uint8_t color);
+};
+
+/** \brief
+ * A line of text rendered once into RAM and then drawn quickly every frame.
+ *
+ * \tparam maxLength The maximum number of characters that can be held.
+ *
+ * \details
+ * Text such as a score or a level name in a game's status display is often
+ * drawn every frame but only changes occasionally. Printing it each frame
+ * goes through the `Print` class, number formatting and `drawChar()` for
+ * every character. A `TextCache` instead renders the text, using the
+ * library's `font5x7` font, into a small buffer of screen columns only when
+ * the text changes. Drawing it just copies the columns into the screen
+ * buffer.
+ *
+ * `setText()` and `setNumber()` can be called every frame. The text is only
+ * rendered again if it's different from before.
+ *
+ * \code{.cpp}
+ * TextCache<5> scoreText;
+ *
+ * // each frame
+ * scoreText.setNumber(score, 5);
+ * scoreText.draw(WIDTH - scoreText.width(), 0);
+ * \endcode
+ *
+ * The text is drawn with a solid background, the same as text printed with
+ * `Arduboy2::setTextBackground()` set to the opposite of the text color, and
+ * is always 8 pixels high. When the Y position is a multiple of 8, the
+ * columns are copied straight into the screen buffer.
+ *
+ * Each character is drawn as its glyph in the font. Control characters,
+ * such as newline, aren't treated specially, the same as with
+ * `Arduboy2::setTextRawMode(true)`.
+ *
+ * \note
+ * The cache uses `maxLength * 7 + 1` bytes of RAM. Text longer than
+ * `maxLength` characters is cut short.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses `TextCache`
+ * must also have `#include <TextCache.h>`.
+ *
+ * \see Arduboy2::drawDigits() Arduboy2::font5x7
+ */
+template <uint8_t maxLength>
+class TextCache : public TextCacheBase
+{
+  static_assert(maxLength != 0 && maxLength <= 255 / charWidth,
+                "maxLength must be between 1 and 42");
+
+ public:
+  TextCache()
+  {
+    text[0] = '\0';
+  }
+
+  /** \brief
+   * Set the text.
+   *
+   * \param newText The text, as a null terminated string in RAM.
+   *
+   * \return `true` if the text changed and was rendered again.
+   */
+  bool setText(const char *newText)
+  {
+    return update(text, columns, maxLength, newText);
+  }
+
+  /** \brief
+   * Set the text to a number.
+   *
+   * \param value The number.
+   * \param digits The minimum number of digits, up to 5, with leading zeros
+   * added as needed (optional; defaults to 0 for no leading zeros).
+   *
+   * \return `true` if the text changed and was rendered again.
+   */
+  bool setNumber(uint16_t value, uint8_t digits = 0)
+  {
+    char buf[6];
+
+    formatNumber(buf, value, digits);
+    return setText(buf);
+  }
+
+  /** \brief
+   * Get the current text.
+   *
+   * \return The text, as a null terminated string.
+   */
+  const char* getText() const
+  {
+    return text;
+  }
+
+  /** \brief
+   * Get the width of the drawn text.
+   *
+   * \return The width in pixels, including the space after the last
+   * character.
+   */
+  uint8_t width() const
+  {
+    return strlen(text) * charWidth;
+  }
+
+  /** \brief
+   * Draw the text into the screen buffer.
+   *
+   * \param x The X coordinate of the left edge of the text.
+   * \param y The Y coordinate of the top edge of the text.
+   * \param color The color of the text, WHITE or BLACK (optional; defaults
+   * to WHITE). The background is drawn in the opposite color.
+   *
+   * \details
+   * Since the text and its background replace what's in the buffer, INVERT
+   * isn't supported. Any color other than BLACK, including INVERT, is drawn
+   * as WHITE.
+   */
+  void draw(int16_t x, int16_t y, uint8_t color = WHITE) const
+  {
+    drawColumns(columns, width(), x, y, color);
+  }
+
+ private:
+  char text[maxLength + 1];
+  uint8_t columns[maxLength * charWidth];
+};
+
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file Tilemap.cpp
+ * \brief
+ * A class for drawing a scrolling background made of 8x8 pixel tiles.
+ */
+
+#include "Tilemap.h"
+
+void Tilemap::draw(int16_t viewX, int16_t viewY) const
+{
+  drawArea(viewX, viewY, 0, 0, WIDTH, HEIGHT);
+}
+
+void Tilemap::drawRows(int16_t viewX, int16_t viewY, uint8_t y, uint8_t h) const
+{
+  drawArea(viewX, viewY, 0, y, WIDTH, h);
+}
+
+void Tilemap::drawColumns(int16_t viewX, int16_t viewY, uint8_t x, uint8_t w) const
+{
+  drawArea(viewX, viewY, x, 0, w, HEIGHT);
+}
+
+// draw an area given in screen coordinates
+void Tilemap::drawArea(int16_t viewX, int16_t viewY,
+                       uint8_t x, uint8_t y, uint8_t w, uint8_t h) const
+{
+  if (x >= WIDTH || y >= HEIGHT || w == 0 || h == 0) {
+    return;
+  }
+  if (w > WIDTH - x) {
+    w = WIDTH - x;
+  }
+  if (h > HEIGHT - y) {
+    h = HEIGHT - y;
+  }
+
+  // When the view has been moved by Arduboy2Base::scrollViewVertical(), the
+  // screen rows may wrap from the bottom of the buffer back to the top. Each
+  // part is drawn separately as a band of buffer rows.
+  uint8_t rowStart = Arduboy2Base::viewToBufferY(y);
+  uint8_t rowsToEnd = HEIGHT - rowStart;
+
+  if (h <= rowsToEnd) {
+    drawBand(viewX + x, x, w, rowStart, rowStart + h, viewY + y - rowStart);
+  }
+  else {
+    drawBand(viewX + x, x, w, rowStart, HEIGHT, viewY + y - rowStart);
+    drawBand(viewX + x, x, w, 0, h - rowsToEnd, viewY + y + rowsToEnd);
+  }
+}
+
+// Draw buffer rows rowStart to rowEnd - 1, from buffer column x for w
+// columns. Buffer row R shows map row (R + mapYOffset) and buffer column x
+// shows map column mapX.
+void Tilemap::drawBand(int16_t mapX, uint8_t x, uint8_t w,
+                       uint8_t rowStart, uint8_t rowEnd,
+                       int16_t mapYOffset) const
+{
+  uint8_t page = rowStart / 8;
+  uint8_t lastPage = (rowEnd - 1) / 8;
+
+  Arduboy2Base::markDirty(x, rowStart, w, rowEnd - rowStart);
+
+  // pixel masks for the partially covered top and bottom bytes
+  uint8_t mask = 0xFF << (rowStart & 7);
+  uint8_t lastMask = 0xFF >> (7 - ((rowEnd - 1) & 7));
+
+  uint8_t *pRow = Arduboy2Base::sBuffer + (page * WIDTH) + x;
+
+  while (true) {
+    if (page == lastPage) {
+      mask &= lastMask;
+    }
+
+    // the map row of the top pixel of this page
+    int16_t mapY = (page * 8) + mapYOffset;
+    int16_t tileY = mapY >> 3;
+    uint8_t shift = mapY & 7;
+
+    uint8_t *pBuf = pRow;
+    int16_t mapCol = mapX;
+    uint8_t count = w;
+
+    do {
+      int16_t tileX = mapCol >> 3;
+      uint8_t col = mapCol & 7;
+      // the number of columns to draw from this tile
+      uint8_t run = 8 - col;
+
+      if (run > count) {
+        run = count;
+      }
+
+      const uint8_t *upper = tile(tileX, tileY);
+
+      if (shift == 0 && mask == 0xFF) {
+        // byte aligned: copy the tile columns straight into the buffer
+        if (upper != nullptr) {
+          memcpy_P(pBuf, upper + col, run);
+        }
+        else {
+          memset(pBuf, 0, run);
+        }
+        pBuf += run;
+      }
+      else {
+        // combine the bottom of the upper tile with the top of the lower one
+        const uint8_t *lower = (shift != 0) ? tile(tileX, tileY + 1) : nullptr;
+
+        for (uint8_t i = col; i < col + run; i++) {
+          uint8_t data = 0;
+
+          if (upper != nullptr) {
+            data = pgm_read_byte(upper + i) >> shift;
+          }
+          if (lower != nullptr) {
+            data |= pgm_read_byte(lower + i) << (8 - shift);
+          }
+          *pBuf = (*pBuf & ~mask) | (data & mask);
+          pBuf++;
+        }
+      }
+
+      mapCol += run;
+      count -= run;
+    } while (count != 0);
+
+    if (page == lastPage) {
+      break;
+    }
+
+    page++;
+    pRow += WIDTH;
+    mask = 0xFF;
+  }
+}
+
+// get a tile's image data, or nullptr if the tile is outside the map
+const uint8_t* Tilemap::tile(int16_t tileX, int16_t tileY) const
+{
+  if (tileX < 0 || tileY < 0 || tileX >= mapWidth || tileY >= mapHeight) {
+    return nullptr;
+  }
+
+  const uint8_t *p = map + (tileY * mapWidth) + tileX;
+  uint8_t index = mapInRAM ? *p : pgm_read_byte(p);
+
+  return tileset + (index * 8);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file Tilemap.h
+ * \brief
+ * A class for drawing a scrolling background made of 8x8 pixel tiles.
+ */
+
+#ifndef Tilemap_h
+#define Tilemap_h
+
+#include "Arduboy2.h"
+
+/** \brief
+ * Draw a scrolling background made of 8x8 pixel tiles.
+ *
+ * \details
+ * A `Tilemap` draws a view of a map made up of a grid of tiles, each 8
+ * pixels wide by 8 pixels high. The map is an array of tile numbers, one
+ * byte per tile, arranged in rows from the top left corner of the map. It
+ * can be in program memory or RAM. The tiles themselves are the frames of an
+ * image in program memory, in the same format used by the `Sprites` class,
+ * so an existing sprite sheet of 8x8 pixel tiles can be used.
+ *
+ * \code{.cpp}
+ * const uint8_t tiles[] PROGMEM = {
+ *   8, 8, // width, height
+ *   // tile 0: empty
+ *   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+ *   // tile 1: brick
+ *   0xFF, 0x91, 0x91, 0xFF, 0xFF, 0x89, 0x89, 0xFF,
+ * };
+ *
+ * const uint8_t level[] PROGMEM = {
+ *   // 32 tiles wide by 8 tiles high
+ *   ...
+ * };
+ *
+ * Tilemap background(level, 32, 8, tiles);
+ *
+ * // in the game loop
+ * background.draw(cameraX, 0);
+ * \endcode
+ *
+ * The tiles are drawn the same as using `Sprites::drawOverwrite()`, but
+ * the whole screen is drawn in one pass rather than clipping and shifting
+ * each tile separately. When the view's Y position is a multiple of 8, the
+ * tile columns are copied straight into the display buffer. Otherwise, each
+ * byte of the buffer is made from the two tiles above and below it.
+ *
+ * Areas of the view outside of the map are drawn as black.
+ *
+ * For sketches that use `Arduboy2Base::scrollViewVertical()` or
+ * `Arduboy2Base::scrollViewHorizontal()`, the `drawRows()` and
+ * `drawColumns()` functions can be used to draw only the rows or columns
+ * of the view that have newly come into view. All the drawing functions
+ * take the current view scroll position of `scrollViewVertical()` into
+ * account.
+ *
+ * \note
+ * A map can be up to 255 tiles wide and 255 tiles high, and use up to 256
+ * different tiles. A map in RAM can be changed while in use, for example to
+ * remove collected items or destroyed blocks.
+ *
+ * \note
+ * This header isn't included by `Arduboy2.h`. A sketch that uses `Tilemap`
+ * must also have `#include <Tilemap.h>`.
+ *
+ * \see Sprites Arduboy2Base::scrollViewVertical()
+ */
+class Tilemap
+{
+ public:
+  /** \brief
+   * Describe a map and the tiles used to draw it.
+   *
+   * \param map An array of tile numbers, one byte per tile, arranged in rows
+   * of `mapWidth` tiles.
+   * \param mapWidth The width of the map, in tiles.
+   * \param mapHeight The height of the map, in tiles.
+   * \param tileset The tile images in program memory, in `Sprites` format,
+   * with a width and height of 8.
+   * \param mapInRAM `true` if the map array is in RAM. `false` if it's in
+   * program memory (optional; defaults to `false`).
+   */
+  Tilemap(const uint8_t *map, uint8_t mapWidth, uint8_t mapHeight,
+          const uint8_t *tileset, bool mapInRAM = false)
+    : map(map), tileset(tileset + 2), mapWidth(mapWidth),
+      mapHeight(mapHeight), mapInRAM(mapInRAM)
+  {
+  }
+
+  /** \brief
+   * Draw the whole screen with the view of the map at the given position.
+   *
+   * \param viewX The X position in the map, in pixels, of the left edge of
+   * the screen.
+   * \param viewY The Y position in the map, in pixels, of the top edge of
+   * the screen.
+   *
+   * \details
+   * Everything on the screen is replaced, so the buffer doesn't have to be
+   * cleared first.
+   */
+  void draw(int16_t viewX, int16_t viewY) const;
+
+  /** \brief
+   * Draw only some rows of the screen with the view of the map at the given
+   * position.
+   *
+   * \param viewX The X position in the map of the left edge of the screen.
+   * \param viewY The Y position in the map of the top edge of the screen.
+   * \param y The first screen row to draw, from 0 to `HEIGHT - 1`.
+   * \param h The number of rows to draw. Rows below the bottom of the screen
+   * are ignored.
+   *
+   * \details
+   * After moving the view using `Arduboy2Base::scrollViewVertical()`, this
+   * can be used to draw only the rows that have newly come into view.
+   *
+   * \code{.cpp}
+   * // the view moves down 2 pixels
+   * cameraY += 2;
+   * arduboy.scrollViewVertical(2);
+   * background.drawRows(cameraX, cameraY, HEIGHT - 2, 2);
+   * arduboy.displayDirty();
+   * \endcode
+   */
+  void drawRows(int16_t viewX, int16_t viewY, uint8_t y, uint8_t h) const;
+
+  /** \brief
+   * Draw only some columns of the screen with the view of the map at the
+   * given position.
+   *
+   * \param viewX The X position in the map of the left edge of the screen.
+   * \param viewY The Y position in the map of the top edge of the screen.
+   * \param x The first screen column to draw, from 0 to `WIDTH - 1`.
+   * \param w The number of columns to draw. Columns beyond the right edge of
+   * the screen are ignored.
+   *
+   * \details
+   * After moving the view using `Arduboy2Base::scrollViewHorizontal()`,
+   * this can be used to draw only the columns that have newly come into
+   * view.
+   */
+  void drawColumns(int16_t viewX, int16_t viewY, uint8_t x, uint8_t w) const;
+
+ private:
+  void drawArea(int16_t viewX, int16_t viewY,
+                uint8_t x, uint8_t y, uint8_t w, uint8_t h) const;
+  void drawBand(int16_t mapX, uint8_t x, uint8_t w,
+                uint8_t rowStart, uint8_t rowEnd, int16_t mapYOffset) const;
+  const uint8_t* tile(int16_t tileX, int16_t tileY) const;
+
+  const uint8_t *map;
+  const uint8_t *tileset; // the first tile's image data
+  uint8_t mapWidth;
+  uint8_t mapHeight;
+  bool mapInRAM;
+};
+
+#endif